@@ -22,3 +22,15 @@ if( USE_PERF_TESTS )
     message( STATUS "Enable performance tests" )
     add_compile_definitions(USE_PERF_TESTS)
 endif( USE_PERF_TESTS )
+
+option(USE_ORDER_CHECKS "Check the order of Task lifecycle calls" ON)
+if( NOT USE_ORDER_CHECKS )
+    message( STATUS "Disable task order checks" )
+    add_compile_definitions(PPC_DISABLE_ORDER_CHECKS)
+endif( NOT USE_ORDER_CHECKS )
+
+option(USE_ALLOC_TRACKING "Replace global operator new/delete in core to count allocations of MemoryTracker" OFF)
+if( USE_ALLOC_TRACKING )
+    message( STATUS "Enable allocation tracking" )
+    add_compile_definitions(PPC_ALLOC_TRACKING)
+endif( USE_ALLOC_TRACKING )
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/serialization/string.hpp>  // NOLINT(*-include-cleaner)
+#include <cstddef>
+#include <filesystem>
+#include <numeric>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/dataset/include/dataset.hpp"
+#include "core/dataset/include/dataset_mpi.hpp"
+#include "core/dist/include/distribution.hpp"
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+// unique file in the working directory, which all ranks of a run share (the temp directory
+// may be node local); the root picks the name and broadcasts it
+std::string SharedTempPath(const boost::mpi::communicator &world) {
+  std::string path;
+  if (world.rank() == 0) {
+#ifdef _WIN32
+    const int pid = _getpid();
+#else
+    const int pid = getpid();
+#endif
+    const std::string test = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    path = (std::filesystem::current_path() /
+            ("ppc_dataset_" + test + "_" + std::to_string(pid) + "_" + std::to_string(std::random_device{}()) + ".bin"))
+               .string();
+  }
+  boost::mpi::broadcast(world, path, 0);
+  return path;
+}
+
+}  // namespace
+
+TEST(dataset_mpi_tests, check_read_distributed) {
+  boost::mpi::communicator world;
+  const std::string path = SharedTempPath(world);
+  // 41 items of two elements, element i holds i
+  constexpr size_t kItems = 41;
+  std::vector<int> global(2 * kItems);
+  std::iota(global.begin(), global.end(), 0);
+  if (world.rank() == 0) {
+    ppc::core::WriteDataset(path, std::span<const int>(global), {kItems, 2});
+  }
+  world.barrier();
+
+  for (const auto &dist : {ppc::core::Distribution::Block(kItems, world.size(), 2),
+                           ppc::core::Distribution::Cyclic(kItems, world.size(), 2),
+                           ppc::core::Distribution::BlockCyclic(kItems, world.size(), 3, 2)}) {
+    std::vector<int> expected;
+    for (auto [first, count] : dist->Runs(world.rank())) {
+      expected.insert(expected.end(), global.begin() + static_cast<std::ptrdiff_t>(2 * first),
+                      global.begin() + static_cast<std::ptrdiff_t>(2 * (first + count)));
+    }
+    EXPECT_EQ(ppc::core::ReadDistributed<int>(world, path, *dist), expected);
+  }
+  EXPECT_THROW(ppc::core::ReadDistributed<int>(world, path, *ppc::core::Distribution::Block(kItems - 1, world.size())),
+               std::invalid_argument);
+  EXPECT_THROW(ppc::core::ReadDistributed<double>(world, path, *ppc::core::Distribution::Block(kItems, world.size())),
+               std::invalid_argument);
+
+  world.barrier();
+  if (world.rank() == 0) {
+    std::filesystem::remove(path);
+  }
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/dataset/include/dataset.hpp"
+#include "core/task/include/task.hpp"
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+// unique per test and process, parallel test runs do not share files
+std::string TempPath(const std::string &name) {
+#ifdef _WIN32
+  const int pid = _getpid();
+#else
+  const int pid = getpid();
+#endif
+  const std::string test = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  return (std::filesystem::temp_directory_path() /
+          ("ppc_dataset_" + test + "_" + name + "_" + std::to_string(pid) + ".bin"))
+      .string();
+}
+
+// temporary files of WriteDataset left next to path
+size_t LeftoverTempFiles(const std::string &path) {
+  const std::filesystem::path target(path);
+  size_t count = 0;
+  for (const auto &entry : std::filesystem::directory_iterator(target.parent_path())) {
+    count += entry.path().filename().string().starts_with(target.filename().string() + ".tmp") ? 1 : 0;
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(dataset_tests, check_write_and_open) {
+  const auto path = TempPath("roundtrip");
+  std::vector<double> data(6 * 7);
+  std::iota(data.begin(), data.end(), 0.5);
+  ppc::core::WriteDataset(path, std::span<const double>(data), {6, 7});
+
+  auto dataset = ppc::core::MappedDataset::Open(path, true);
+  EXPECT_EQ(dataset.Type(), ppc::core::DType::kFloat64);
+  EXPECT_EQ(dataset.Shape(), (std::vector<size_t>{6, 7}));
+  EXPECT_EQ(dataset.Count(), data.size());
+  auto view = dataset.Data<double>();
+  EXPECT_EQ(std::vector<double>(view.begin(), view.end()), data);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(view.data()) % alignof(double), 0U);
+  EXPECT_THROW(static_cast<void>(dataset.Data<float>()), std::invalid_argument);
+
+  const auto info = ppc::core::ReadDatasetInfo(path);
+  EXPECT_EQ(info.dtype, ppc::core::DType::kFloat64);
+  EXPECT_EQ(info.shape, (std::vector<size_t>{6, 7}));
+  EXPECT_EQ(info.count, data.size());
+
+  // the task input points into the mapping, writes to it do not reach the file
+  ppc::core::TaskData task_data;
+  dataset.AddInput(task_data);
+  ASSERT_EQ(task_data.inputs.size(), 1U);
+  EXPECT_EQ(task_data.inputs[0], reinterpret_cast<uint8_t *>(view.data()));
+  EXPECT_EQ(task_data.inputs_count[0], data.size());
+  view[0] = -1.0;
+  EXPECT_EQ(ppc::core::MappedDataset::Open(path, true).Data<double>()[0], 0.5);
+
+  auto moved = std::move(dataset);
+  EXPECT_EQ(moved.Data<double>()[1], 1.5);
+  std::filesystem::remove(path);
+}
+
+TEST(dataset_tests, check_broken_files) {
+  EXPECT_THROW(ppc::core::MappedDataset::Open(TempPath("missing")), std::runtime_error);
+  EXPECT_THROW(static_cast<void>(ppc::core::ReadDatasetInfo(TempPath("missing"))), std::runtime_error);
+
+  const auto path = TempPath("broken");
+  {
+    std::ofstream file(path);
+    file << "not a dataset, just some text of the old format that is long enough for a header";
+  }
+  EXPECT_THROW(ppc::core::MappedDataset::Open(path), std::runtime_error);
+
+  std::vector<int32_t> data(100, 3);
+  ppc::core::WriteDataset(path, std::span<const int32_t>(data), {10, 10});
+  // corrupt one payload byte: sizes still match, only the checksum catches it
+  {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(ppc::core::MappedDataset::kHeaderSize) + 5);
+    file.put('x');
+  }
+  EXPECT_NO_THROW(ppc::core::MappedDataset::Open(path));
+  EXPECT_THROW(ppc::core::MappedDataset::Open(path, true), std::runtime_error);
+
+  // truncated payload
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+  EXPECT_THROW(ppc::core::MappedDataset::Open(path), std::runtime_error);
+  EXPECT_THROW(static_cast<void>(ppc::core::ReadDatasetInfo(path)), std::runtime_error);
+  std::filesystem::remove(path);
+
+  EXPECT_THROW(ppc::core::WriteDataset(path, std::span<const int32_t>(data), {10, 9}), std::invalid_argument);
+  EXPECT_THROW(ppc::core::WriteDataset(path, std::span<const int32_t>(data), {1, 1, 1, 1, 100}),
+               std::invalid_argument);
+}
+
+TEST(dataset_tests, check_cached_dataset) {
+  const auto path = TempPath("cached");
+  const auto cache_path = ppc::core::CachedDatasetPath(path, "iota", 1);
+  int calls = 0;
+  auto generate = [&](std::span<uint8_t> data) {
+    calls++;
+    std::iota(data.begin(), data.end(), uint8_t{0});
+  };
+  {
+    auto dataset = ppc::core::CachedDataset<uint8_t>(path, {16}, "iota", 1, generate);
+    EXPECT_EQ(dataset.Data<uint8_t>()[15], 15);
+  }
+  EXPECT_TRUE(std::filesystem::exists(cache_path));
+  auto again = ppc::core::CachedDataset<uint8_t>(path, {16}, "iota", 1, generate);
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(again.Data<uint8_t>()[3], 3);
+
+  // another shape is generated again
+  auto other = ppc::core::CachedDataset<uint8_t>(path, {4, 8}, "iota", 1, generate);
+  EXPECT_EQ(calls, 2);
+  EXPECT_EQ(other.Count(), 32U);
+
+  // another seed or generator never reuses the file
+  EXPECT_NE(ppc::core::CachedDatasetPath(path, "iota", 2), cache_path);
+  EXPECT_NE(ppc::core::CachedDatasetPath(path, "ramp", 1), cache_path);
+  auto seeded = ppc::core::CachedDataset<uint8_t>(path, {4, 8}, "iota", 2, generate);
+  EXPECT_EQ(calls, 3);
+
+  // a damaged payload is generated again
+  {
+    std::fstream file(cache_path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(ppc::core::MappedDataset::kHeaderSize) + 7);
+    file.put('x');
+  }
+  auto repaired = ppc::core::CachedDataset<uint8_t>(path, {4, 8}, "iota", 1, generate);
+  EXPECT_EQ(calls, 4);
+  EXPECT_EQ(repaired.Data<uint8_t>()[7], 7);
+  EXPECT_EQ(LeftoverTempFiles(cache_path), 0U);
+  std::filesystem::remove(cache_path);
+  std::filesystem::remove(ppc::core::CachedDatasetPath(path, "iota", 2));
+}
+
+TEST(dataset_tests, check_failed_write_cleans_up) {
+  // the target is a directory, so the final rename fails
+  const auto path = TempPath("directory");
+  std::filesystem::create_directory(path);
+  std::vector<int32_t> data(10, 1);
+  EXPECT_ANY_THROW(ppc::core::WriteDataset(path, std::span<const int32_t>(data), {10}));
+  EXPECT_EQ(LeftoverTempFiles(path), 0U);
+  std::filesystem::remove(path);
+}
+
+#ifdef __linux__
+TEST(dataset_tests, check_add_input_count_limit) {
+  // header of 2^32 bytes over a sparse file, the payload is never read
+  const auto path = TempPath("huge");
+  std::vector<uint8_t> data(1, 0);
+  ppc::core::WriteDataset(path, std::span<const uint8_t>(data), {1});
+  const uint64_t count = uint64_t{1} << 32;
+  {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    // shape[0] follows magic, version, dtype, rank and a reserved field
+    file.seekp(24);
+    file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+  }
+  std::filesystem::resize_file(path, ppc::core::MappedDataset::kHeaderSize + count);
+  auto dataset = ppc::core::MappedDataset::Open(path);
+  EXPECT_EQ(dataset.Count(), count);
+  ppc::core::TaskData task_data;
+  EXPECT_THROW(dataset.AddInput(task_data), std::length_error);
+  EXPECT_TRUE(task_data.inputs.empty());
+  std::filesystem::remove(path);
+}
+#endif
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "core/mem/include/arena.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+enum class DType : uint32_t { kInt8 = 1, kUInt8, kInt32, kUInt32, kInt64, kUInt64, kFloat32, kFloat64 };
+
+template <typename T>
+constexpr DType DTypeOf() {
+  if constexpr (std::is_same_v<T, int8_t>) {
+    return DType::kInt8;
+  } else if constexpr (std::is_same_v<T, uint8_t>) {
+    return DType::kUInt8;
+  } else if constexpr (std::is_same_v<T, int32_t>) {
+    return DType::kInt32;
+  } else if constexpr (std::is_same_v<T, uint32_t>) {
+    return DType::kUInt32;
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    return DType::kInt64;
+  } else if constexpr (std::is_same_v<T, uint64_t>) {
+    return DType::kUInt64;
+  } else if constexpr (std::is_same_v<T, float>) {
+    return DType::kFloat32;
+  } else {
+    static_assert(std::is_same_v<T, double>, "unsupported dataset element type");
+    return DType::kFloat64;
+  }
+}
+
+size_t DTypeSize(DType dtype);
+
+// 64-bit hash of the payload stored in the dataset header
+uint64_t DatasetChecksum(const void *data, size_t bytes);
+
+// Binary dataset file: a 64 byte header (magic, version, dtype, up to 4 dimensions,
+// checksum of the payload) followed by the raw little-endian elements, so the payload
+// is aligned for any dtype once the file is mapped.
+//
+// Open maps the file copy-on-write (Linux; read into memory elsewhere): pages are loaded
+// on first access and writes of a task to its input never reach the file.
+class MappedDataset {
+ public:
+  constexpr static size_t kMaxRank = 4;
+  constexpr static size_t kHeaderSize = 64;
+
+  MappedDataset() = default;
+  MappedDataset(const MappedDataset &) = delete;
+  MappedDataset &operator=(const MappedDataset &) = delete;
+  MappedDataset(MappedDataset &&other) noexcept;
+  MappedDataset &operator=(MappedDataset &&other) noexcept;
+  ~MappedDataset();
+
+  // throws std::runtime_error if the file can not be read or its header does not match
+  // its size; verify_checksum reads the whole payload
+  static MappedDataset Open(const std::string &path, bool verify_checksum = false);
+
+  [[nodiscard]] DType Type() const { return dtype_; }
+  [[nodiscard]] const std::vector<size_t> &Shape() const { return shape_; }
+  // number of elements
+  [[nodiscard]] size_t Count() const { return DTypeSize(dtype_) == 0 ? 0 : bytes_ / DTypeSize(dtype_); }
+  [[nodiscard]] size_t Bytes() const { return bytes_; }
+
+  template <typename T>
+  [[nodiscard]] std::span<T> Data() const {
+    if (DTypeOf<T>() != dtype_) {
+      throw std::invalid_argument("Dataset element type does not match");
+    }
+    return {reinterpret_cast<T *>(payload_), Count()};
+  }
+
+  // registers the mapped payload as the next input of task_data without a copy, the
+  // dataset has to outlive the task; throws std::length_error if the element count does
+  // not fit the 32 bit inputs_count
+  void AddInput(TaskData &task_data) const;
+
+ private:
+  void Close();
+
+  uint8_t *payload_ = nullptr;
+  size_t bytes_ = 0;
+  DType dtype_ = DType::kUInt8;
+  std::vector<size_t> shape_;
+  // whole file when mapped, the payload read into memory otherwise
+  void *mapping_ = nullptr;
+  size_t mapping_bytes_ = 0;
+  AlignedBuffer buffer_;
+};
+
+// type and shape of a dataset file from its header alone, throws like MappedDataset::Open;
+// for readers that load slices of the payload themselves (core/dataset/include/dataset_mpi.hpp)
+struct DatasetInfo {
+  DType dtype = DType::kUInt8;
+  std::vector<size_t> shape;
+  size_t count = 0;
+};
+
+DatasetInfo ReadDatasetInfo(const std::string &path);
+
+// writes the file through a temporary one with a unique name and renames it, so readers
+// never see a half written dataset and concurrent writers (MPI ranks, parallel tests) do not
+// share it; the element count has to match the product of shape
+void WriteDataset(const std::string &path, DType dtype, const void *data, const std::vector<size_t> &shape);
+
+template <typename T>
+void WriteDataset(const std::string &path, std::span<const T> data, const std::vector<size_t> &shape) {
+  size_t count = 1;
+  for (auto dim : shape) {
+    count *= dim;
+  }
+  if (count != data.size()) {
+    throw std::invalid_argument("Dataset shape does not match the data");
+  }
+  WriteDataset(path, DTypeOf<T>(), data.data(), shape);
+}
+
+// file of the cached dataset made by generator with seed, next to path
+std::string CachedDatasetPath(const std::string &path, const std::string &generator, uint64_t seed);
+
+// maps the cache file of (path, generator, seed) if it holds a dataset of T with this shape
+// and an intact payload, otherwise fills a buffer with generate, writes it to the file and
+// maps the result; for generated inputs reused between runs. generator names the generator
+// and its parameters (file name characters only), so changing any of them or the seed never
+// returns stale data.
+template <typename T>
+MappedDataset CachedDataset(const std::string &path, const std::vector<size_t> &shape, const std::string &generator,
+                            uint64_t seed, const std::function<void(std::span<T>)> &generate) {
+  const auto cache_path = CachedDatasetPath(path, generator, seed);
+  try {
+    auto dataset = MappedDataset::Open(cache_path, true);
+    if (dataset.Type() == DTypeOf<T>() && dataset.Shape() == shape) {
+      return dataset;
+    }
+  } catch (const std::runtime_error &) {
+    // missing or broken cache file, generate it again
+  }
+  size_t count = 1;
+  for (auto dim : shape) {
+    count *= dim;
+  }
+  std::vector<T> data(count);
+  generate(std::span<T>(data));
+  WriteDataset(cache_path, std::span<const T>(data), shape);
+  return MappedDataset::Open(cache_path);
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <array>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/dataset/include/dataset.hpp"
+#include "core/dist/include/distribution.hpp"
+#include "core/dist/include/distribution_mpi.hpp"
+#include "core/dist/include/map_reduce_mpi.hpp"
+
+// Parallel reads of dataset files (core/dataset) with MPI-IO: every rank reads its own slice
+// of the payload from the shared file in one collective call instead of receiving it from
+// the root, so input distribution scales with the number of ranks.
+namespace ppc::core {
+
+// header read by the root only and broadcast, a large run does not hit the file system with
+// a small read per rank; throws std::runtime_error on every rank if the root can not read it
+inline DatasetInfo BroadcastDatasetInfo(const boost::mpi::communicator &comm, const std::string &path, int root = 0) {
+  // dtype (0 if the header is broken), rank, dimensions
+  std::array<uint64_t, 2 + MappedDataset::kMaxRank> packed{};
+  if (comm.rank() == root) {
+    try {
+      const auto info = ReadDatasetInfo(path);
+      packed[0] = static_cast<uint64_t>(info.dtype);
+      packed[1] = info.shape.size();
+      for (size_t i = 0; i < info.shape.size(); i++) {
+        packed[2 + i] = info.shape[i];
+      }
+    } catch (const std::runtime_error &) {
+      packed[0] = 0;
+    }
+  }
+  MPI_Bcast(packed.data(), static_cast<int>(packed.size()), MPI_UINT64_T, root, comm);
+  if (packed[0] == 0) {
+    throw std::runtime_error("Can not read dataset " + path);
+  }
+  DatasetInfo info;
+  info.dtype = static_cast<DType>(packed[0]);
+  info.shape.assign(packed.begin() + 2, packed.begin() + 2 + static_cast<std::ptrdiff_t>(packed[1]));
+  info.count = 1;
+  for (auto dim : info.shape) {
+    info.count *= dim;
+  }
+  return info;
+}
+
+namespace detail {
+
+// collective read of count elements through a file view of the payload starting at first,
+// filetype selects the elements of the rank (MPI_DATATYPE_NULL for a contiguous run)
+template <typename T>
+void ReadDatasetView(const boost::mpi::communicator &comm, const std::string &path, size_t first,
+                     MPI_Datatype filetype, T *local, size_t count) {
+  if (count > static_cast<size_t>(INT_MAX)) {
+    throw std::overflow_error("Dataset slice does not fit int counts of MPI");
+  }
+  const auto element = boost::mpi::get_mpi_datatype<T>(T{});
+  MPI_File file = MPI_FILE_NULL;
+  if (MPI_File_open(comm, path.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &file) != MPI_SUCCESS) {
+    throw std::runtime_error("Can not open dataset " + path);
+  }
+  const auto displacement = static_cast<MPI_Offset>(MappedDataset::kHeaderSize + (first * sizeof(T)));
+  if (MPI_File_set_view(file, displacement, element, filetype == MPI_DATATYPE_NULL ? element : filetype, "native",
+                        MPI_INFO_NULL) != MPI_SUCCESS) {
+    MPI_File_close(&file);
+    throw std::runtime_error("Can not set the view of dataset " + path);
+  }
+  MPI_Status status;
+  const int result = MPI_File_read_at_all(file, 0, local, static_cast<int>(count), element, &status);
+  int read = 0;
+  MPI_Get_count(&status, element, &read);
+  MPI_File_close(&file);
+  if (result != MPI_SUCCESS || static_cast<size_t>(read) != count) {
+    throw std::runtime_error("Can not read dataset " + path);
+  }
+}
+
+template <typename T>
+void CheckDatasetType(const DatasetInfo &info, const std::string &path) {
+  if (info.dtype != DTypeOf<T>()) {
+    throw std::invalid_argument("Dataset element type does not match: " + path);
+  }
+}
+
+}  // namespace detail
+
+// elements [first, first + count) of the payload of every rank, collective over comm
+template <typename T>
+std::vector<T> ReadDatasetSlice(const boost::mpi::communicator &comm, const std::string &path, size_t first,
+                                size_t count) {
+  std::vector<T> local(count);
+  detail::ReadDatasetView(comm, path, first, MPI_DATATYPE_NULL, local.data(), count);
+  return local;
+}
+
+// the items of the rank in dist (Counts()[rank] elements, same layout as Scatter), the runs of
+// cyclic distributions are selected by a file view so the read stays a single collective call
+template <typename T>
+std::vector<T> ReadDistributed(const boost::mpi::communicator &comm, const std::string &path,
+                               const Distribution &dist, int root = 0) {
+  detail::CheckRanks(comm, dist);
+  const auto info = BroadcastDatasetInfo(comm, path, root);
+  detail::CheckDatasetType<T>(info, path);
+  if (info.count != dist.NumItems() * dist.ItemSize()) {
+    throw std::invalid_argument("Distribution does not match the size of dataset " + path);
+  }
+  const int rank = comm.rank();
+  std::vector<T> local(dist.Counts()[rank]);
+  if (dist.IsContiguous() || local.empty()) {
+    const size_t first = local.empty() ? 0 : static_cast<size_t>(dist.Displs()[rank]);
+    detail::ReadDatasetView(comm, path, first, MPI_DATATYPE_NULL, local.data(), local.size());
+    return local;
+  }
+  auto filetype = detail::RunsDatatype(dist, rank, boost::mpi::get_mpi_datatype<T>(T{}));
+  try {
+    detail::ReadDatasetView(comm, path, 0, filetype, local.data(), local.size());
+  } catch (...) {
+    MPI_Type_free(&filetype);
+    throw;
+  }
+  MPI_Type_free(&filetype);
+  return local;
+}
+
+// MapReduce over the payload of a dataset file of T elements: every rank reads its run and
+// halo from the file with MPI-IO, the root only reads the header
+template <typename T, typename Acc, typename Map, typename Combine>
+Acc MapReduceDataset(const boost::mpi::communicator &comm, const std::string &path, Acc identity, Map map,
+                     Combine combine, const MapReduceOptions &options = {}) {
+  static_assert(boost::mpi::is_mpi_datatype<T>::value, "MapReduce needs an element type with an MPI datatype");
+  const auto info = BroadcastDatasetInfo(comm, path, options.root);
+  detail::CheckDatasetType<T>(info, path);
+  auto dist = Distribution::Block(info.count, comm.size());
+
+  const int rank = comm.rank();
+  const size_t own = dist->ItemCount(rank);
+  const size_t first = own > 0 ? static_cast<size_t>(dist->Displs()[rank]) : 0;
+  const auto items = ReadDatasetSlice<T>(comm, path, first, own + detail::HaloCount(*dist, rank, options.halo));
+  return detail::MapAndReduce(comm, std::span<const T>(items), own, identity, map, combine, options);
+}
+
+}  // namespace ppc::core
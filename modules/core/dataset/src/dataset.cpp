@@ -0,0 +1,268 @@
+#include "core/dataset/include/dataset.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "core/mem/include/arena.hpp"
+#include "core/task/include/task.hpp"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::array<char, 8> kMagic = {'P', 'P', 'C', 'D', 'A', 'T', 'A', '\0'};
+constexpr uint32_t kVersion = 1;
+
+struct FileHeader {
+  std::array<char, 8> magic;
+  uint32_t version;
+  uint32_t dtype;
+  uint32_t rank;
+  uint32_t reserved;
+  std::array<uint64_t, ppc::core::MappedDataset::kMaxRank> shape;
+  uint64_t checksum;
+};
+static_assert(sizeof(FileHeader) == ppc::core::MappedDataset::kHeaderSize);
+
+// shape and payload size of a header read from path, throws if they do not agree
+std::pair<std::vector<size_t>, size_t> CheckHeader(const FileHeader &header, size_t file_bytes,
+                                                   const std::string &path) {
+  if (header.magic != kMagic || header.version != kVersion || header.rank > ppc::core::MappedDataset::kMaxRank) {
+    throw std::runtime_error("Not a dataset file: " + path);
+  }
+  const size_t element = ppc::core::DTypeSize(static_cast<ppc::core::DType>(header.dtype));
+  if (element == 0) {
+    throw std::runtime_error("Unknown element type in " + path);
+  }
+  std::vector<size_t> shape(header.shape.begin(), header.shape.begin() + header.rank);
+  size_t bytes = element;
+  for (auto dim : shape) {
+    bytes *= dim;
+  }
+  if (file_bytes != ppc::core::MappedDataset::kHeaderSize + bytes) {
+    throw std::runtime_error("Dataset size does not match its header: " + path);
+  }
+  return {shape, bytes};
+}
+
+// new empty file next to path that no other writer uses
+std::string MakeTempFile(const std::string &path) {
+#ifdef __linux__
+  std::string tmp_path = path + ".tmp.XXXXXX";
+  const int fd = mkstemp(tmp_path.data());
+  if (fd < 0) {
+    throw std::runtime_error("Can not write dataset " + path);
+  }
+  // mkstemp creates the file for the owner only
+  fchmod(fd, 0644);
+  close(fd);
+  return tmp_path;
+#else
+  std::random_device random;
+  return path + ".tmp." + std::to_string(random()) + std::to_string(random());
+#endif
+}
+
+}  // namespace
+
+size_t ppc::core::DTypeSize(DType dtype) {
+  switch (dtype) {
+    case DType::kInt8:
+    case DType::kUInt8:
+      return 1;
+    case DType::kInt32:
+    case DType::kUInt32:
+    case DType::kFloat32:
+      return 4;
+    case DType::kInt64:
+    case DType::kUInt64:
+    case DType::kFloat64:
+      return 8;
+  }
+  return 0;
+}
+
+uint64_t ppc::core::DatasetChecksum(const void *data, size_t bytes) {
+  // FNV-1a over 8 byte words with a final avalanche, several GB/s
+  constexpr uint64_t kPrime = 0x100000001B3ULL;
+  const auto *ptr = static_cast<const uint8_t *>(data);
+  uint64_t hash = 0xCBF29CE484222325ULL ^ bytes;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= bytes; i += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    std::memcpy(&word, ptr + i, sizeof(word));
+    hash = (hash ^ word) * kPrime;
+  }
+  for (; i < bytes; i++) {
+    hash = (hash ^ ptr[i]) * kPrime;
+  }
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDULL;
+  return hash ^ (hash >> 33);
+}
+
+ppc::core::MappedDataset::MappedDataset(MappedDataset &&other) noexcept
+    : payload_(std::exchange(other.payload_, nullptr)),
+      bytes_(std::exchange(other.bytes_, 0)),
+      dtype_(other.dtype_),
+      shape_(std::move(other.shape_)),
+      mapping_(std::exchange(other.mapping_, nullptr)),
+      mapping_bytes_(std::exchange(other.mapping_bytes_, 0)),
+      buffer_(std::move(other.buffer_)) {}
+
+ppc::core::MappedDataset &ppc::core::MappedDataset::operator=(MappedDataset &&other) noexcept {
+  if (this != &other) {
+    Close();
+    payload_ = std::exchange(other.payload_, nullptr);
+    bytes_ = std::exchange(other.bytes_, 0);
+    dtype_ = other.dtype_;
+    shape_ = std::move(other.shape_);
+    mapping_ = std::exchange(other.mapping_, nullptr);
+    mapping_bytes_ = std::exchange(other.mapping_bytes_, 0);
+    buffer_ = std::move(other.buffer_);
+  }
+  return *this;
+}
+
+ppc::core::MappedDataset::~MappedDataset() { Close(); }
+
+void ppc::core::MappedDataset::Close() {
+#ifdef __linux__
+  if (mapping_ != nullptr) {
+    munmap(mapping_, mapping_bytes_);
+  }
+#endif
+  mapping_ = nullptr;
+  mapping_bytes_ = 0;
+  payload_ = nullptr;
+  bytes_ = 0;
+  buffer_ = AlignedBuffer();
+}
+
+ppc::core::MappedDataset ppc::core::MappedDataset::Open(const std::string &path, bool verify_checksum) {
+  MappedDataset dataset;
+  FileHeader header{};
+#ifdef __linux__
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Can not open dataset " + path);
+  }
+  struct stat info{};
+  if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < kHeaderSize) {
+    close(fd);
+    throw std::runtime_error("Not a dataset file: " + path);
+  }
+  const auto file_bytes = static_cast<size_t>(info.st_size);
+  // private writable mapping: tasks may modify their inputs in place
+  void *mapping = mmap(nullptr, file_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("Can not map dataset " + path);
+  }
+  dataset.mapping_ = mapping;
+  dataset.mapping_bytes_ = file_bytes;
+  std::memcpy(&header, mapping, kHeaderSize);
+  auto [shape, bytes] = CheckHeader(header, file_bytes, path);
+  dataset.payload_ = static_cast<uint8_t *>(mapping) + kHeaderSize;
+#else
+  std::ifstream file(path, std::ios::binary);
+  if (!file || !file.read(reinterpret_cast<char *>(&header), kHeaderSize)) {
+    throw std::runtime_error("Can not read dataset " + path);
+  }
+  auto [shape, bytes] = CheckHeader(header, std::filesystem::file_size(path), path);
+  dataset.buffer_ = AlignedBuffer(bytes, false);
+  dataset.payload_ = static_cast<uint8_t *>(dataset.buffer_.Data());
+  if (!file.read(reinterpret_cast<char *>(dataset.payload_), static_cast<std::streamsize>(bytes))) {
+    throw std::runtime_error("Can not read dataset " + path);
+  }
+#endif
+  dataset.bytes_ = bytes;
+  dataset.shape_ = std::move(shape);
+  dataset.dtype_ = static_cast<DType>(header.dtype);
+  if (verify_checksum && DatasetChecksum(dataset.payload_, bytes) != header.checksum) {
+    throw std::runtime_error("Dataset checksum mismatch: " + path);
+  }
+  return dataset;
+}
+
+ppc::core::DatasetInfo ppc::core::ReadDatasetInfo(const std::string &path) {
+  FileHeader header{};
+  std::ifstream file(path, std::ios::binary);
+  if (!file || !file.read(reinterpret_cast<char *>(&header), MappedDataset::kHeaderSize)) {
+    throw std::runtime_error("Can not read dataset " + path);
+  }
+  auto [shape, bytes] = CheckHeader(header, std::filesystem::file_size(path), path);
+  DatasetInfo info;
+  info.dtype = static_cast<DType>(header.dtype);
+  info.count = bytes / DTypeSize(info.dtype);
+  info.shape = std::move(shape);
+  return info;
+}
+
+void ppc::core::MappedDataset::AddInput(TaskData &task_data) const {
+  if (Count() > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("Dataset has more elements than inputs_count can hold");
+  }
+  task_data.inputs.emplace_back(payload_);
+  task_data.inputs_count.emplace_back(Count());
+}
+
+void ppc::core::WriteDataset(const std::string &path, DType dtype, const void *data,
+                             const std::vector<size_t> &shape) {
+  if (shape.size() > MappedDataset::kMaxRank || DTypeSize(dtype) == 0) {
+    throw std::invalid_argument("Dataset supports up to 4 dimensions of a known type");
+  }
+  FileHeader header{};
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.dtype = static_cast<uint32_t>(dtype);
+  header.rank = static_cast<uint32_t>(shape.size());
+  size_t bytes = DTypeSize(dtype);
+  for (size_t i = 0; i < shape.size(); i++) {
+    header.shape[i] = shape[i];
+    bytes *= shape[i];
+  }
+  header.checksum = DatasetChecksum(data, bytes);
+
+  const std::string tmp_path = MakeTempFile(path);
+  try {
+    {
+      std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+      file.write(reinterpret_cast<const char *>(&header), MappedDataset::kHeaderSize);
+      file.write(static_cast<const char *>(data), static_cast<std::streamsize>(bytes));
+      if (!file) {
+        throw std::runtime_error("Can not write dataset " + path);
+      }
+    }
+    std::filesystem::rename(tmp_path, path);
+  } catch (...) {
+    std::error_code ignored;
+    std::filesystem::remove(tmp_path, ignored);
+    throw;
+  }
+}
+
+std::string ppc::core::CachedDatasetPath(const std::string &path, const std::string &generator, uint64_t seed) {
+  std::ostringstream cache_path;
+  cache_path << path << '.' << generator << '.' << std::hex << std::setw(16) << std::setfill('0') << seed;
+  return cache_path.str();
+}
@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "core/dist/include/distribution.hpp"
+#include "core/dist/include/distribution_mpi.hpp"
+
+TEST(distribution_mpi_tests, check_all_gather) {
+  boost::mpi::communicator world;
+  // 23 items of two elements, element i holds i
+  constexpr size_t kItems = 23;
+  std::vector<int> expected(2 * kItems);
+  std::iota(expected.begin(), expected.end(), 0);
+
+  for (const auto &dist : {ppc::core::Distribution::Block(kItems, world.size(), 2),
+                           ppc::core::Distribution::Cyclic(kItems, world.size(), 2),
+                           ppc::core::Distribution::BlockCyclic(kItems, world.size(), 3, 2)}) {
+    std::vector<int> local;
+    for (auto [first, count] : dist->Runs(world.rank())) {
+      for (size_t i = 2 * first; i < 2 * (first + count); i++) {
+        local.push_back(static_cast<int>(i));
+      }
+    }
+    std::vector<int> global(expected.size(), -1);
+    ppc::core::AllGather(world, *dist, local.data(), global.data());
+    EXPECT_EQ(global, expected) << "rank " << world.rank();
+  }
+}
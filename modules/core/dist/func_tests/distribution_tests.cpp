@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/dist/include/distribution.hpp"
+
+namespace {
+
+// every item is owned exactly once and the index maps are inverse to each other
+void CheckConsistent(const ppc::core::Distribution &dist) {
+  std::vector<int> owners(dist.NumItems(), -1);
+  size_t total = 0;
+  for (int rank = 0; rank < dist.NumRanks(); rank++) {
+    size_t local = 0;
+    for (auto [first, count] : dist.Runs(rank)) {
+      for (size_t item = first; item < first + count; item++, local++) {
+        ASSERT_EQ(owners[item], -1);
+        owners[item] = rank;
+        EXPECT_EQ(dist.Owner(item), rank);
+        EXPECT_EQ(dist.LocalIndex(item), local);
+        EXPECT_EQ(dist.GlobalIndex(rank, local), item);
+      }
+    }
+    EXPECT_EQ(local, dist.ItemCount(rank));
+    EXPECT_EQ(static_cast<size_t>(dist.Counts()[rank]), dist.ItemCount(rank) * dist.ItemSize());
+    total += local;
+  }
+  EXPECT_EQ(total, dist.NumItems());
+}
+
+}  // namespace
+
+TEST(distribution_tests, check_block) {
+  auto dist = ppc::core::Distribution::Block(10, 4, 3);
+  EXPECT_TRUE(dist->IsContiguous());
+  EXPECT_EQ(dist->Counts(), (std::vector<int>{9, 9, 6, 6}));
+  EXPECT_EQ(dist->Displs(), (std::vector<int>{0, 9, 18, 24}));
+  CheckConsistent(*dist);
+
+  // more ranks than items: the last ranks stay empty
+  auto sparse = ppc::core::Distribution::Block(2, 5);
+  EXPECT_EQ(sparse->Counts(), (std::vector<int>{1, 1, 0, 0, 0}));
+  CheckConsistent(*sparse);
+  CheckConsistent(*ppc::core::Distribution::Block(0, 3));
+}
+
+TEST(distribution_tests, check_cyclic) {
+  auto dist = ppc::core::Distribution::Cyclic(7, 3, 2);
+  EXPECT_FALSE(dist->IsContiguous());
+  EXPECT_EQ(dist->Counts(), (std::vector<int>{6, 4, 4}));
+  EXPECT_EQ(dist->Runs(1), (std::vector<std::pair<size_t, size_t>>{{1, 1}, {4, 1}}));
+  EXPECT_EQ(dist->Owner(5), 2);
+  CheckConsistent(*dist);
+
+  auto blocks = ppc::core::Distribution::BlockCyclic(11, 3, 2);
+  EXPECT_EQ(blocks->Runs(0), (std::vector<std::pair<size_t, size_t>>{{0, 2}, {6, 2}}));
+  // the tail block of one item goes to the rank after the last full block
+  EXPECT_EQ(blocks->Runs(2), (std::vector<std::pair<size_t, size_t>>{{4, 2}, {10, 1}}));
+  CheckConsistent(*blocks);
+
+  // a single rank owns everything in one run
+  EXPECT_TRUE(ppc::core::Distribution::Cyclic(5, 1)->IsContiguous());
+}
+
+TEST(distribution_tests, check_weighted) {
+  auto dist = ppc::core::Distribution::Weighted(10, {1.0, 2.0, 2.0}, 4);
+  EXPECT_EQ(dist->Counts(), (std::vector<int>{8, 16, 16}));
+  CheckConsistent(*dist);
+
+  // rounding: 7 items by 1:1:1 hand the extra item to the first rank
+  auto even = ppc::core::Distribution::Weighted(7, {1.0, 1.0, 1.0});
+  EXPECT_EQ(even->Counts(), (std::vector<int>{3, 2, 2}));
+  auto idle = ppc::core::Distribution::Weighted(5, {0.0, 1.0});
+  EXPECT_EQ(idle->Counts(), (std::vector<int>{0, 5}));
+  CheckConsistent(*idle);
+
+  EXPECT_THROW(static_cast<void>(ppc::core::Distribution::Weighted(5, {0.0, 0.0})), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(ppc::core::Distribution::Weighted(5, {-1.0, 2.0})), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(ppc::core::Distribution::Weighted(5, {})), std::invalid_argument);
+}
+
+TEST(distribution_tests, check_cache_and_limits) {
+  auto first = ppc::core::Distribution::Block(1000, 4, 16);
+  auto second = ppc::core::Distribution::Block(1000, 4, 16);
+  EXPECT_EQ(first.get(), second.get());
+  EXPECT_NE(first.get(), ppc::core::Distribution::Block(1000, 4, 8).get());
+  EXPECT_NE(first.get(), ppc::core::Distribution::Cyclic(1000, 4, 16).get());
+  EXPECT_GE(ppc::core::Distribution::CacheSize(), 3U);
+
+  EXPECT_THROW(static_cast<void>(ppc::core::Distribution::Block(10, 0)), std::invalid_argument);
+  EXPECT_EQ(ppc::core::Distribution::Block(10, 2, 0)->Counts(), (std::vector<int>{0, 0}));
+  EXPECT_THROW(static_cast<void>(ppc::core::Distribution::BlockCyclic(10, 2, 0)), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(ppc::core::Distribution::Block(size_t{1} << 31, 2)), std::overflow_error);
+}
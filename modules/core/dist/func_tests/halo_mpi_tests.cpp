@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "core/dist/include/halo_mpi.hpp"
+
+namespace {
+
+// scatters rows x cols cells numbered row * 1000 + col, exchanges the halos and checks every
+// cell of the padded block: neighbour cells in the halo, zero where the array ends; the
+// negated block has to come back to the root through Gather. A wrong cell on one rank stops
+// all of them before the Gather, so a failure does not hang the run.
+void CheckHaloExchange(size_t rows, size_t cols, size_t halo, ppc::core::HaloLayout layout) {
+  boost::mpi::communicator world;
+  auto cell = [](ptrdiff_t row, ptrdiff_t col) { return static_cast<int>((row * 1000) + col); };
+  std::vector<int> global(rows * cols);
+  for (size_t row = 0; row < rows; row++) {
+    for (size_t col = 0; col < cols; col++) {
+      global[(row * cols) + col] = cell(static_cast<ptrdiff_t>(row), static_cast<ptrdiff_t>(col));
+    }
+  }
+
+  ppc::core::HaloExchange<int> exchange(world, rows, cols, halo, layout);
+  exchange.Scatter(world.rank() == 0 ? global.data() : nullptr);
+  // twice, the persistent requests are reused
+  exchange.Exchange();
+  exchange.Exchange();
+
+  const auto first_row = static_cast<ptrdiff_t>(exchange.FirstRow());
+  const auto first_col = static_cast<ptrdiff_t>(exchange.FirstCol());
+  const auto width = static_cast<ptrdiff_t>(halo);
+  bool ok = true;
+  for (ptrdiff_t row = -width; row < static_cast<ptrdiff_t>(exchange.Rows()) + width && ok; row++) {
+    for (ptrdiff_t col = -width; col < static_cast<ptrdiff_t>(exchange.Cols()) + width && ok; col++) {
+      const ptrdiff_t global_row = first_row + row;
+      const ptrdiff_t global_col = first_col + col;
+      const bool inside = global_row >= 0 && global_row < static_cast<ptrdiff_t>(rows) && global_col >= 0 &&
+                          global_col < static_cast<ptrdiff_t>(cols);
+      EXPECT_EQ(exchange.At(row, col), inside ? cell(global_row, global_col) : 0)
+          << "rank " << world.rank() << ", cell " << row << " " << col;
+      ok = exchange.At(row, col) == (inside ? cell(global_row, global_col) : 0);
+    }
+  }
+  ASSERT_TRUE(boost::mpi::all_reduce(world, ok, std::logical_and<>()));
+
+  for (ptrdiff_t row = 0; row < static_cast<ptrdiff_t>(exchange.Rows()); row++) {
+    for (ptrdiff_t col = 0; col < static_cast<ptrdiff_t>(exchange.Cols()); col++) {
+      exchange.At(row, col) = -exchange.At(row, col);
+    }
+  }
+  std::vector<int> gathered(world.rank() == 0 ? global.size() : 0);
+  exchange.Gather(gathered.data());
+  if (world.rank() == 0) {
+    for (auto &value : global) {
+      value = -value;
+    }
+    EXPECT_EQ(gathered, global);
+  }
+}
+
+}  // namespace
+
+TEST(halo_mpi_tests, check_rows) {
+  boost::mpi::communicator world;
+  CheckHaloExchange((3 * static_cast<size_t>(world.size())) + 2, 5, 1, ppc::core::HaloLayout::kRows);
+}
+
+TEST(halo_mpi_tests, check_rows_wide_halo) {
+  boost::mpi::communicator world;
+  CheckHaloExchange((3 * static_cast<size_t>(world.size())) + 2, 4, 3, ppc::core::HaloLayout::kRows);
+}
+
+TEST(halo_mpi_tests, check_grid_wide_halo) {
+  boost::mpi::communicator world;
+  const size_t size = (2 * static_cast<size_t>(world.size())) + 1;
+  CheckHaloExchange(size, size + 3, 2, ppc::core::HaloLayout::kGrid);
+}
+
+TEST(halo_mpi_tests, check_rejects_halo_wider_than_block) {
+  boost::mpi::communicator world;
+  if (world.size() < 2) {
+    GTEST_SKIP();
+  }
+  EXPECT_THROW(ppc::core::HaloExchange<int>(world, 2 * static_cast<size_t>(world.size()), 4, 3),
+               std::invalid_argument);
+}
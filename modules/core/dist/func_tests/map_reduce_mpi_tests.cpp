@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "core/dist/include/map_reduce_mpi.hpp"
+#include "core/pool/include/thread_pool.hpp"
+
+namespace {
+
+// element i is (i * 37) % 101, different for neighbours
+std::vector<int> MakeInput(size_t size) {
+  std::vector<int> input(size);
+  for (size_t i = 0; i < size; i++) {
+    input[i] = static_cast<int>((i * 37) % 101);
+  }
+  return input;
+}
+
+// sum over the windows of halo + 1 elements starting at every element, cut at the end
+int64_t WindowSums(std::span<const int> items, size_t own, size_t halo) {
+  int64_t sum = 0;
+  for (size_t i = 0; i < own; i++) {
+    const size_t last = std::min(i + halo + 1, items.size());
+    for (size_t j = i; j < last; j++) {
+      sum += items[j];
+    }
+  }
+  return sum;
+}
+
+// MapReduce of the window sums against the sequential reference, the input is only set on the root
+void CheckWindowSums(size_t size, const ppc::core::MapReduceOptions &options) {
+  boost::mpi::communicator world;
+  const auto input = MakeInput(size);
+  const bool root = world.rank() == options.root;
+  const auto res = ppc::core::MapReduce(
+      world, root ? input.data() : nullptr, root ? size : 0, int64_t{0},
+      [&](std::span<const int> items, size_t own) { return WindowSums(items, own, options.halo); },
+      [](int64_t a, int64_t b) { return a + b; }, options);
+  if (root || options.all_ranks) {
+    EXPECT_EQ(res, WindowSums(input, size, options.halo)) << "rank " << world.rank();
+  }
+}
+
+}  // namespace
+
+TEST(map_reduce_mpi_tests, check_halo) {
+  boost::mpi::communicator world;
+  CheckWindowSums((7 * static_cast<size_t>(world.size())) + 3, {.halo = 1});
+  CheckWindowSums(1, {.halo = 1});
+  CheckWindowSums(0, {.halo = 1});
+}
+
+TEST(map_reduce_mpi_tests, check_pool_with_wide_halo) {
+  boost::mpi::communicator world;
+  ppc::core::ThreadPool pool(3);
+  CheckWindowSums((250 * static_cast<size_t>(world.size())) + 7, {.halo = 3, .pool = &pool});
+  CheckWindowSums(2, {.halo = 3, .pool = &pool});
+}
+
+TEST(map_reduce_mpi_tests, check_all_ranks) {
+  boost::mpi::communicator world;
+  CheckWindowSums((5 * static_cast<size_t>(world.size())) + 1, {.halo = 2, .all_ranks = true});
+  CheckWindowSums((5 * static_cast<size_t>(world.size())) + 1,
+                  {.halo = 2, .all_ranks = true, .root = world.size() - 1});
+}
+
+// with n = ranks + 1 the root holds two elements and the others one, so a halo of 3 is wider
+// than the run of the next rank and has to come from the root (n = 5 on 4 ranks)
+TEST(map_reduce_mpi_tests, check_halo_from_root) {
+  boost::mpi::communicator world;
+  const size_t size = static_cast<size_t>(world.size()) + 1;
+  CheckWindowSums(size, {.halo = 3});
+  CheckWindowSums(size, {.halo = 3, .all_ranks = true, .root = world.size() - 1});
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ppc::core {
+
+// Split of num_items items (elements, matrix rows) of item_size elements each over the ranks
+// of a communicator. Instances are immutable and shared through a process-wide cache, so the
+// counts and displacements are computed once per shape and reused by every run.
+class Distribution {
+ public:
+  enum class Kind : uint8_t {
+    // one contiguous run per rank, sizes differ by at most one item, lower ranks take the remainder
+    kBlock,
+    // item i goes to rank i % num_ranks
+    kCyclic,
+    // runs of block items dealt to the ranks round-robin
+    kBlockCyclic,
+    // one contiguous run per rank proportional to the rank weight (largest remainder rounding)
+    kWeighted,
+  };
+
+  static std::shared_ptr<const Distribution> Block(size_t num_items, int num_ranks, size_t item_size = 1);
+  static std::shared_ptr<const Distribution> Cyclic(size_t num_items, int num_ranks, size_t item_size = 1);
+  static std::shared_ptr<const Distribution> BlockCyclic(size_t num_items, int num_ranks, size_t block,
+                                                         size_t item_size = 1);
+  // weights are relative speeds of the ranks, one per rank, not negative and not all zero
+  static std::shared_ptr<const Distribution> Weighted(size_t num_items, const std::vector<double> &weights,
+                                                      size_t item_size = 1);
+
+  [[nodiscard]] Kind GetKind() const { return kind_; }
+  [[nodiscard]] size_t NumItems() const { return num_items_; }
+  [[nodiscard]] size_t ItemSize() const { return item_size_; }
+  [[nodiscard]] int NumRanks() const { return static_cast<int>(item_counts_.size()); }
+  // every rank owns a single run of consecutive items (block and weighted kinds)
+  [[nodiscard]] bool IsContiguous() const { return contiguous_; }
+
+  [[nodiscard]] size_t ItemCount(int rank) const { return item_counts_[rank]; }
+  // rank owning the global item and the index of the item among the items of that rank
+  [[nodiscard]] int Owner(size_t item) const;
+  [[nodiscard]] size_t LocalIndex(size_t item) const;
+  [[nodiscard]] size_t GlobalIndex(int rank, size_t local_item) const;
+  // runs of consecutive global items owned by the rank: {first item, number of items}
+  [[nodiscard]] std::vector<std::pair<size_t, size_t>> Runs(int rank) const;
+
+  // scatterv/gatherv arguments in elements (items times item_size), displacements
+  // are only meaningful for contiguous distributions
+  [[nodiscard]] const std::vector<int> &Counts() const { return counts_; }
+  [[nodiscard]] const std::vector<int> &Displs() const { return displs_; }
+
+  // entries kept by the cache, for tests
+  static size_t CacheSize();
+
+ private:
+  Distribution(Kind kind, size_t num_items, size_t item_size, size_t block, std::vector<size_t> item_counts);
+
+  Kind kind_;
+  size_t num_items_;
+  size_t item_size_;
+  size_t block_;
+  bool contiguous_;
+  std::vector<size_t> item_counts_;
+  // first item of every rank for contiguous distributions
+  std::vector<size_t> first_items_;
+  std::vector<int> counts_;
+  std::vector<int> displs_;
+};
+
+}  // namespace ppc::core
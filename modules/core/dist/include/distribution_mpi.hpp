@@ -0,0 +1,141 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "core/dist/include/distribution.hpp"
+
+// Scatter/gather of the items of a Distribution straight between the global buffer of the root and
+// the local buffers of the ranks: scatterv/gatherv for contiguous distributions, point-to-point
+// messages with an indexed datatype per rank for cyclic ones. No rank packs, pads or copies data
+// except the root for its own items.
+namespace ppc::core {
+
+namespace detail {
+
+constexpr int kDistributionTag = 31415;
+
+inline void CheckRanks(const boost::mpi::communicator &comm, const Distribution &dist) {
+  if (dist.NumRanks() != comm.size()) {
+    throw std::invalid_argument("Distribution is made for another number of ranks");
+  }
+}
+
+// elements of the runs of the rank in the global buffer
+inline MPI_Datatype RunsDatatype(const Distribution &dist, int rank, MPI_Datatype element) {
+  std::vector<int> lengths;
+  std::vector<int> displs;
+  for (auto [first, count] : dist.Runs(rank)) {
+    lengths.push_back(static_cast<int>(count * dist.ItemSize()));
+    displs.push_back(static_cast<int>(first * dist.ItemSize()));
+  }
+  MPI_Datatype type = MPI_DATATYPE_NULL;
+  MPI_Type_indexed(static_cast<int>(lengths.size()), lengths.data(), displs.data(), element, &type);
+  MPI_Type_commit(&type);
+  return type;
+}
+
+template <typename T>
+void CopyOwnRuns(const Distribution &dist, int rank, T *global, T *local, bool to_local) {
+  size_t offset = 0;
+  for (auto [first, count] : dist.Runs(rank)) {
+    const size_t elements = count * dist.ItemSize();
+    T *global_run = global + (first * dist.ItemSize());
+    for (size_t i = 0; i < elements; i++) {
+      if (to_local) {
+        local[offset + i] = global_run[i];
+      } else {
+        global_run[i] = local[offset + i];
+      }
+    }
+    offset += elements;
+  }
+}
+
+// point-to-point exchange of the root with every other rank through indexed datatypes
+template <typename T>
+void ExchangeRuns(const boost::mpi::communicator &comm, const Distribution &dist, T *global, T *local, int root,
+                  bool scatter) {
+  const auto element = boost::mpi::get_mpi_datatype<T>(T{});
+  const int rank = comm.rank();
+  if (rank != root) {
+    if (scatter) {
+      MPI_Recv(local, dist.Counts()[rank], element, root, kDistributionTag, comm, MPI_STATUS_IGNORE);
+    } else {
+      MPI_Send(local, dist.Counts()[rank], element, root, kDistributionTag, comm);
+    }
+    return;
+  }
+  std::vector<MPI_Request> requests;
+  std::vector<MPI_Datatype> types;
+  for (int other = 0; other < comm.size(); other++) {
+    if (other == root) {
+      continue;
+    }
+    types.push_back(RunsDatatype(dist, other, element));
+    requests.emplace_back();
+    if (scatter) {
+      MPI_Isend(global, 1, types.back(), other, kDistributionTag, comm, &requests.back());
+    } else {
+      MPI_Irecv(global, 1, types.back(), other, kDistributionTag, comm, &requests.back());
+    }
+  }
+  CopyOwnRuns(dist, root, global, local, scatter);
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+  for (auto &type : types) {
+    MPI_Type_free(&type);
+  }
+}
+
+}  // namespace detail
+
+// global (root only, NumItems() * ItemSize() elements) -> local (Counts()[rank] elements)
+template <typename T>
+void Scatter(const boost::mpi::communicator &comm, const Distribution &dist, const T *global, T *local,
+             int root = 0) {
+  static_assert(boost::mpi::is_mpi_datatype<T>::value, "Scatter needs a type with an MPI datatype");
+  detail::CheckRanks(comm, dist);
+  if (dist.IsContiguous()) {
+    const auto element = boost::mpi::get_mpi_datatype<T>(T{});
+    MPI_Scatterv(global, dist.Counts().data(), dist.Displs().data(), element, local, dist.Counts()[comm.rank()],
+                 element, root, comm);
+    return;
+  }
+  detail::ExchangeRuns(comm, dist, const_cast<T *>(global), local, root, true);
+}
+
+// local (Counts()[rank] elements) -> global (root only, NumItems() * ItemSize() elements)
+template <typename T>
+void Gather(const boost::mpi::communicator &comm, const Distribution &dist, const T *local, T *global, int root = 0) {
+  static_assert(boost::mpi::is_mpi_datatype<T>::value, "Gather needs a type with an MPI datatype");
+  detail::CheckRanks(comm, dist);
+  if (dist.IsContiguous()) {
+    const auto element = boost::mpi::get_mpi_datatype<T>(T{});
+    MPI_Gatherv(local, dist.Counts()[comm.rank()], element, global, dist.Counts().data(), dist.Displs().data(),
+                element, root, comm);
+    return;
+  }
+  detail::ExchangeRuns(comm, dist, global, const_cast<T *>(local), root, false);
+}
+
+// local (Counts()[rank] elements) -> global on every rank
+template <typename T>
+void AllGather(const boost::mpi::communicator &comm, const Distribution &dist, const T *local, T *global) {
+  static_assert(boost::mpi::is_mpi_datatype<T>::value, "AllGather needs a type with an MPI datatype");
+  detail::CheckRanks(comm, dist);
+  const auto element = boost::mpi::get_mpi_datatype<T>(T{});
+  if (dist.IsContiguous()) {
+    MPI_Allgatherv(local, dist.Counts()[comm.rank()], element, global, dist.Counts().data(), dist.Displs().data(),
+                   element, comm);
+    return;
+  }
+  Gather(comm, dist, local, global, 0);
+  MPI_Bcast(global, static_cast<int>(dist.NumItems() * dist.ItemSize()), element, 0, comm);
+}
+
+}  // namespace ppc::core
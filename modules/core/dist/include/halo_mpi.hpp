@@ -0,0 +1,245 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <array>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/dist/include/distribution.hpp"
+
+// Halo exchange for stencils over a rows x cols array split into blocks of the ranks. Every
+// rank keeps its block inside a buffer padded by halo cells on each side; the exchange runs
+// on persistent requests with subarray datatypes created once, so repeated exchanges neither
+// pack nor allocate, and Start()/Wait() let a task compute the interior of its block while
+// the boundaries are in flight.
+namespace ppc::core {
+
+enum class HaloLayout : uint8_t {
+  // blocks of whole rows, neighbours above and below
+  kRows,
+  // tiles of a near square grid of ranks (MPI_Dims_create), eight neighbours including the
+  // diagonal ones for 9-point stencils
+  kGrid,
+};
+
+template <typename T>
+class HaloExchange {
+ public:
+  HaloExchange(const boost::mpi::communicator &comm, size_t rows, size_t cols, size_t halo,
+               HaloLayout layout = HaloLayout::kRows)
+      : comm_(comm), global_rows_(rows), global_cols_(cols), halo_(halo) {
+    static_assert(boost::mpi::is_mpi_datatype<T>::value, "HaloExchange needs a type with an MPI datatype");
+    std::array<int, 2> dims = {comm.size(), 1};
+    if (layout == HaloLayout::kGrid) {
+      dims = {0, 0};
+      MPI_Dims_create(comm.size(), 2, dims.data());
+    }
+    grid_cols_ = dims[1];
+    row_dist_ = Distribution::Block(rows, dims[0]);
+    col_dist_ = Distribution::Block(cols, dims[1]);
+    CheckHalo(*row_dist_);
+    CheckHalo(*col_dist_);
+    if (rows + (2 * halo) > static_cast<size_t>(INT_MAX) || cols + (2 * halo) > static_cast<size_t>(INT_MAX)) {
+      throw std::overflow_error("HaloExchange does not fit int sizes of MPI");
+    }
+
+    const int grid_row = comm.rank() / grid_cols_;
+    const int grid_col = comm.rank() % grid_cols_;
+    first_row_ = static_cast<size_t>(row_dist_->Displs()[grid_row]);
+    first_col_ = static_cast<size_t>(col_dist_->Displs()[grid_col]);
+    rows_ = row_dist_->ItemCount(grid_row);
+    cols_ = col_dist_->ItemCount(grid_col);
+    data_.resize((rows_ + (2 * halo)) * (cols_ + (2 * halo)));
+    if (rows_ == 0 || cols_ == 0) {
+      return;
+    }
+    interior_ = PaddedSubarray({rows_, cols_}, {halo, halo});
+
+    for (int dy = -1; dy <= 1; dy++) {
+      for (int dx = -1; dx <= 1; dx++) {
+        const int row = grid_row + dy;
+        const int col = grid_col + dx;
+        if ((dy == 0 && dx == 0) || halo == 0 || row < 0 || row >= dims[0] || col < 0 || col >= dims[1] ||
+            row_dist_->ItemCount(row) == 0 || col_dist_->ItemCount(col) == 0) {
+          continue;
+        }
+        const std::array<size_t, 2> sizes = {dy == 0 ? rows_ : halo, dx == 0 ? cols_ : halo};
+        // the halo cells of the own block and the block cells the neighbour needs as its halo
+        const std::array<size_t, 2> recv_at = {Shift(dy, rows_, true), Shift(dx, cols_, true)};
+        const std::array<size_t, 2> send_at = {Shift(dy, rows_, false), Shift(dx, cols_, false)};
+        const int neighbour = (row * grid_cols_) + col;
+        types_.push_back(PaddedSubarray(sizes, recv_at));
+        requests_.emplace_back();
+        MPI_Recv_init(data_.data(), 1, types_.back(), neighbour, Tag(-dy, -dx), comm_, &requests_.back());
+        types_.push_back(PaddedSubarray(sizes, send_at));
+        requests_.emplace_back();
+        MPI_Send_init(data_.data(), 1, types_.back(), neighbour, Tag(dy, dx), comm_, &requests_.back());
+      }
+    }
+  }
+
+  HaloExchange(const HaloExchange &) = delete;
+  HaloExchange &operator=(const HaloExchange &) = delete;
+  HaloExchange(HaloExchange &&) = delete;
+  HaloExchange &operator=(HaloExchange &&) = delete;
+
+  ~HaloExchange() {
+    for (auto &request : requests_) {
+      MPI_Request_free(&request);
+    }
+    for (auto &type : types_) {
+      MPI_Type_free(&type);
+    }
+    if (interior_ != MPI_DATATYPE_NULL) {
+      MPI_Type_free(&interior_);
+    }
+  }
+
+  // the own block: Rows() x Cols() cells starting at (FirstRow(), FirstCol()) of the array
+  [[nodiscard]] size_t Rows() const { return rows_; }
+  [[nodiscard]] size_t Cols() const { return cols_; }
+  [[nodiscard]] size_t FirstRow() const { return first_row_; }
+  [[nodiscard]] size_t FirstCol() const { return first_col_; }
+  [[nodiscard]] size_t Halo() const { return halo_; }
+
+  // cell of the block, rows and columns in [-Halo(), Rows() + Halo()) reach into the halo;
+  // halo cells on sides without a neighbour keep what the task wrote there (zero initially)
+  T &At(ptrdiff_t row, ptrdiff_t col) { return data_[Index(row, col)]; }
+  const T &At(ptrdiff_t row, ptrdiff_t col) const { return data_[Index(row, col)]; }
+  // block with its halo, rows of Cols() + 2 * Halo() cells
+  [[nodiscard]] std::span<T> Padded() { return data_; }
+
+  // posts the receives and sends of all halos
+  void Start() {
+    if (!requests_.empty()) {
+      MPI_Startall(static_cast<int>(requests_.size()), requests_.data());
+    }
+  }
+  // completes the exchange, the halo cells hold the cells of the neighbours afterwards
+  void Wait() {
+    if (!requests_.empty()) {
+      MPI_Waitall(static_cast<int>(requests_.size()), requests_.data(), MPI_STATUSES_IGNORE);
+    }
+  }
+  void Exchange() {
+    Start();
+    Wait();
+  }
+
+  // rows x cols array of the root -> blocks of all ranks (halo cells untouched), collective
+  void Scatter(const T *global, int root = 0) { Distribute(const_cast<T *>(global), root, true); }
+  // blocks of all ranks -> rows x cols array of the root, collective
+  void Gather(T *global, int root = 0) { Distribute(global, root, false); }
+
+ private:
+  static constexpr int kHaloTag = 16180;
+  static constexpr int kDistributeTag = kHaloTag + 9;
+
+  static int Tag(int dy, int dx) { return kHaloTag + ((dy + 1) * 3) + (dx + 1); }
+
+  // first row (column) of the cells sent towards or received from direction d
+  [[nodiscard]] size_t Shift(int d, size_t extent, bool halo_side) const {
+    if (d == 0) {
+      return halo_;
+    }
+    if (d < 0) {
+      return halo_side ? 0 : halo_;
+    }
+    return halo_side ? halo_ + extent : extent;
+  }
+
+  void CheckHalo(const Distribution &dist) const {
+    // the halo has to come from the adjacent block alone
+    for (int block = 1; block < dist.NumRanks(); block++) {
+      if (dist.ItemCount(block) > 0 && dist.ItemCount(block) < halo_) {
+        throw std::invalid_argument("Halo is wider than the block of a neighbour");
+      }
+    }
+  }
+
+  [[nodiscard]] size_t Index(ptrdiff_t row, ptrdiff_t col) const {
+    const auto halo = static_cast<ptrdiff_t>(halo_);
+    return static_cast<size_t>(((row + halo) * static_cast<ptrdiff_t>(cols_ + (2 * halo_))) + col + halo);
+  }
+
+  [[nodiscard]] MPI_Datatype Subarray(std::array<size_t, 2> sizes, std::array<size_t, 2> subsizes,
+                                      std::array<size_t, 2> starts) const {
+    const std::array<int, 2> int_sizes = {static_cast<int>(sizes[0]), static_cast<int>(sizes[1])};
+    const std::array<int, 2> int_subsizes = {static_cast<int>(subsizes[0]), static_cast<int>(subsizes[1])};
+    const std::array<int, 2> int_starts = {static_cast<int>(starts[0]), static_cast<int>(starts[1])};
+    MPI_Datatype type = MPI_DATATYPE_NULL;
+    MPI_Type_create_subarray(2, int_sizes.data(), int_subsizes.data(), int_starts.data(), MPI_ORDER_C,
+                             boost::mpi::get_mpi_datatype<T>(T{}), &type);
+    MPI_Type_commit(&type);
+    return type;
+  }
+
+  // cells of the padded buffer
+  [[nodiscard]] MPI_Datatype PaddedSubarray(std::array<size_t, 2> subsizes, std::array<size_t, 2> starts) const {
+    return Subarray({rows_ + (2 * halo_), cols_ + (2 * halo_)}, subsizes, starts);
+  }
+
+  void Distribute(T *global, int root, bool scatter) {
+    std::vector<MPI_Request> requests;
+    std::vector<MPI_Datatype> blocks;
+    if (comm_.rank() == root) {
+      for (int other = 0; other < comm_.size(); other++) {
+        const int grid_row = other / grid_cols_;
+        const int grid_col = other % grid_cols_;
+        const size_t rows = row_dist_->ItemCount(grid_row);
+        const size_t cols = col_dist_->ItemCount(grid_col);
+        if (rows == 0 || cols == 0) {
+          continue;
+        }
+        blocks.push_back(Subarray({global_rows_, global_cols_}, {rows, cols},
+                                  {static_cast<size_t>(row_dist_->Displs()[grid_row]),
+                                   static_cast<size_t>(col_dist_->Displs()[grid_col])}));
+        requests.emplace_back();
+        if (scatter) {
+          MPI_Isend(global, 1, blocks.back(), other, kDistributeTag, comm_, &requests.back());
+        } else {
+          MPI_Irecv(global, 1, blocks.back(), other, kDistributeTag, comm_, &requests.back());
+        }
+      }
+    }
+    if (interior_ != MPI_DATATYPE_NULL) {
+      requests.emplace_back();
+      if (scatter) {
+        MPI_Irecv(data_.data(), 1, interior_, root, kDistributeTag, comm_, &requests.back());
+      } else {
+        MPI_Isend(data_.data(), 1, interior_, root, kDistributeTag, comm_, &requests.back());
+      }
+    }
+    MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    for (auto &type : blocks) {
+      MPI_Type_free(&type);
+    }
+  }
+
+  boost::mpi::communicator comm_;
+  size_t global_rows_;
+  size_t global_cols_;
+  size_t halo_;
+  int grid_cols_ = 1;
+  std::shared_ptr<const Distribution> row_dist_;
+  std::shared_ptr<const Distribution> col_dist_;
+  size_t first_row_ = 0;
+  size_t first_col_ = 0;
+  size_t rows_ = 0;
+  size_t cols_ = 0;
+  std::vector<T> data_;
+  // own block inside the padded buffer
+  MPI_Datatype interior_ = MPI_DATATYPE_NULL;
+  std::vector<MPI_Datatype> types_;
+  std::vector<MPI_Request> requests_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives/all_gather.hpp>
+#include <boost/mpi/collectives/gather.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "core/dist/include/distribution.hpp"
+#include "core/pool/include/thread_pool.hpp"
+
+// Map-reduce over a vector that only the root holds: block distribution of the elements, an
+// optional halo of the elements that follow the own run (for operations on neighbours), a
+// local kernel over contiguous spans and a reduction of the partial results in rank order.
+// The dataset file variant is MapReduceDataset in core/dataset/include/dataset_mpi.hpp.
+namespace ppc::core {
+
+struct MapReduceOptions {
+  // elements after the own run every rank sees as well, fewer at the end of the input
+  size_t halo = 0;
+  // splits the own run of every rank over the pool, nullptr runs the kernel once per rank
+  ThreadPool *pool = nullptr;
+  // result on every rank instead of the root only
+  bool all_ranks = false;
+  int root = 0;
+};
+
+namespace detail {
+
+constexpr int kHaloTag = 27182;
+
+// elements after the own run the rank needs
+inline size_t HaloCount(const Distribution &dist, int rank, size_t halo) {
+  if (dist.ItemCount(rank) == 0) {
+    return 0;
+  }
+  const size_t end = static_cast<size_t>(dist.Displs()[rank]) + dist.ItemCount(rank);
+  return std::min(halo, dist.NumItems() - end);
+}
+
+// own run plus halo of the rank: the root reads straight from the global buffer, the other
+// ranks receive the run with scatterv and the halo from the next rank (from the root when a
+// halo is wider than the run of the next rank)
+template <typename T>
+std::span<const T> ScatterWithHalo(const boost::mpi::communicator &comm, const Distribution &dist, const T *global,
+                                   size_t halo, int root, std::vector<T> &buffer) {
+  const auto element = boost::mpi::get_mpi_datatype<T>(T{});
+  const int rank = comm.rank();
+  const size_t own = dist.ItemCount(rank);
+  const size_t own_halo = HaloCount(dist, rank, halo);
+  if (rank == root) {
+    MPI_Scatterv(global, dist.Counts().data(), dist.Displs().data(), element, MPI_IN_PLACE, 0, element, root, comm);
+  } else {
+    buffer.resize(own + own_halo);
+    MPI_Scatterv(nullptr, nullptr, nullptr, element, buffer.data(), static_cast<int>(own), element, root, comm);
+  }
+  const T *items = rank == root ? global + dist.Displs()[rank] : buffer.data();
+  T *halo_items = rank == root ? nullptr : buffer.data() + own;
+
+  bool from_next = true;
+  for (int other = 0; other + 1 < comm.size(); other++) {
+    from_next = from_next && HaloCount(dist, other, halo) <= dist.ItemCount(other + 1);
+  }
+  if (from_next) {
+    const size_t prev_halo = rank > 0 ? HaloCount(dist, rank - 1, halo) : 0;
+    const int dest = prev_halo > 0 && rank - 1 != root ? rank - 1 : MPI_PROC_NULL;
+    const int source = own_halo > 0 && rank != root ? rank + 1 : MPI_PROC_NULL;
+    MPI_Sendrecv(items, dest == MPI_PROC_NULL ? 0 : static_cast<int>(prev_halo), element, dest, kHaloTag,
+                 halo_items, source == MPI_PROC_NULL ? 0 : static_cast<int>(own_halo), element, source,
+                 kHaloTag, comm, MPI_STATUS_IGNORE);
+  } else if (rank == root) {
+    std::vector<MPI_Request> requests;
+    for (int other = 0; other < comm.size(); other++) {
+      const size_t count = HaloCount(dist, other, halo);
+      if (other != root && count > 0) {
+        const size_t end = static_cast<size_t>(dist.Displs()[other]) + dist.ItemCount(other);
+        requests.emplace_back();
+        MPI_Isend(global + end, static_cast<int>(count), element, other, kHaloTag, comm, &requests.back());
+      }
+    }
+    MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+  } else if (own_halo > 0) {
+    MPI_Recv(halo_items, static_cast<int>(own_halo), element, root, kHaloTag, comm, MPI_STATUS_IGNORE);
+  }
+  return {items, own + own_halo};
+}
+
+// kernel over the own run (split over the pool if there is one) and reduction in rank order
+template <typename T, typename Acc, typename Map, typename Combine>
+Acc MapAndReduce(const boost::mpi::communicator &comm, std::span<const T> items, size_t own, Acc identity, Map &map,
+                 Combine &combine, const MapReduceOptions &options) {
+  Acc local = identity;
+  if (own > 0 && options.pool != nullptr) {
+    local = options.pool->ParallelReduce(
+        0, own, identity,
+        [&](size_t begin, size_t end) {
+          const size_t last = std::min(end + options.halo, items.size());
+          return map(items.subspan(begin, last - begin), end - begin);
+        },
+        combine);
+  } else if (own > 0) {
+    local = map(items, own);
+  }
+
+  std::vector<Acc> partial;
+  if (options.all_ranks) {
+    boost::mpi::all_gather(comm, local, partial);
+  } else {
+    boost::mpi::gather(comm, local, partial, options.root);
+  }
+  Acc res = identity;
+  for (const auto &value : partial) {
+    res = combine(res, value);
+  }
+  return res;
+}
+
+}  // namespace detail
+
+// map(std::span<const T> items, size_t own) -> Acc over a run of own elements followed by up to
+// halo elements of the input (items.size() < own + halo only at the end of the input).
+// combine(Acc, Acc) -> Acc must be associative with identity as the neutral element, the
+// partial results are combined left to right so the result does not depend on the number of
+// ranks or threads for exact types. The span is contiguous, kernels written as plain loops
+// over it are vectorized by the compiler. size and global are only read on the root, the
+// result is valid on the root (every rank with options.all_ranks).
+template <typename T, typename Acc, typename Map, typename Combine>
+Acc MapReduce(const boost::mpi::communicator &comm, const T *global, size_t size, Acc identity, Map map,
+              Combine combine, const MapReduceOptions &options = {}) {
+  static_assert(boost::mpi::is_mpi_datatype<T>::value, "MapReduce needs an element type with an MPI datatype");
+  auto total = static_cast<uint64_t>(size);
+  MPI_Bcast(&total, 1, MPI_UINT64_T, options.root, comm);
+  auto dist = Distribution::Block(total, comm.size());
+
+  std::vector<T> buffer;
+  const auto items = detail::ScatterWithHalo(comm, *dist, global, options.halo, options.root, buffer);
+  return detail::MapAndReduce(comm, items, dist->ItemCount(comm.rank()), identity, map, combine, options);
+}
+
+}  // namespace ppc::core
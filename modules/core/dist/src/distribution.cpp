@@ -0,0 +1,190 @@
+#include "core/dist/include/distribution.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using CacheKey = std::tuple<ppc::core::Distribution::Kind, size_t, size_t, size_t, std::vector<double>, int>;
+
+// distributions of a test run have a handful of shapes, the cap only guards long sweeps
+constexpr size_t kMaxCacheEntries = 256;
+
+std::mutex cache_mutex;
+std::map<CacheKey, std::shared_ptr<const ppc::core::Distribution>> cache;
+
+template <typename Make>
+std::shared_ptr<const ppc::core::Distribution> FindOrMake(const CacheKey &key, Make make) {
+  const std::scoped_lock lock(cache_mutex);
+  auto it = cache.find(key);
+  if (it != cache.end()) {
+    return it->second;
+  }
+  if (cache.size() >= kMaxCacheEntries) {
+    cache.clear();
+  }
+  auto distribution = make();
+  cache.emplace(key, distribution);
+  return distribution;
+}
+
+void CheckShape(size_t num_items, int num_ranks, size_t item_size) {
+  if (num_ranks <= 0) {
+    throw std::invalid_argument("Distribution needs at least one rank");
+  }
+  if (item_size != 0 && num_items > static_cast<size_t>(INT_MAX) / item_size) {
+    throw std::overflow_error("Distribution does not fit int counts of MPI");
+  }
+}
+
+std::vector<size_t> BlockCyclicCounts(size_t num_items, int num_ranks, size_t block) {
+  const auto ranks = static_cast<size_t>(num_ranks);
+  const size_t full_blocks = num_items / block;
+  const size_t tail = num_items % block;
+  std::vector<size_t> counts(ranks);
+  for (size_t rank = 0; rank < ranks; rank++) {
+    counts[rank] = ((full_blocks / ranks) + (rank < full_blocks % ranks ? 1 : 0)) * block;
+  }
+  counts[full_blocks % ranks] += tail;
+  return counts;
+}
+
+}  // namespace
+
+ppc::core::Distribution::Distribution(Kind kind, size_t num_items, size_t item_size, size_t block,
+                                      std::vector<size_t> item_counts)
+    : kind_(kind),
+      num_items_(num_items),
+      item_size_(item_size),
+      block_(block),
+      contiguous_(kind == Kind::kBlock || kind == Kind::kWeighted || item_counts.size() == 1),
+      item_counts_(std::move(item_counts)) {
+  const auto ranks = item_counts_.size();
+  first_items_.resize(ranks);
+  counts_.resize(ranks);
+  displs_.resize(ranks);
+  size_t first = 0;
+  for (size_t rank = 0; rank < ranks; rank++) {
+    first_items_[rank] = first;
+    counts_[rank] = static_cast<int>(item_counts_[rank] * item_size_);
+    displs_[rank] = static_cast<int>(first * item_size_);
+    first += item_counts_[rank];
+  }
+}
+
+std::shared_ptr<const ppc::core::Distribution> ppc::core::Distribution::Block(size_t num_items, int num_ranks,
+                                                                              size_t item_size) {
+  CheckShape(num_items, num_ranks, item_size);
+  return FindOrMake({Kind::kBlock, num_items, item_size, 0, {}, num_ranks}, [&] {
+    const auto ranks = static_cast<size_t>(num_ranks);
+    std::vector<size_t> counts(ranks, num_items / ranks);
+    for (size_t rank = 0; rank < num_items % ranks; rank++) {
+      counts[rank]++;
+    }
+    return std::shared_ptr<const Distribution>(new Distribution(Kind::kBlock, num_items, item_size, 0, counts));
+  });
+}
+
+std::shared_ptr<const ppc::core::Distribution> ppc::core::Distribution::Cyclic(size_t num_items, int num_ranks,
+                                                                               size_t item_size) {
+  CheckShape(num_items, num_ranks, item_size);
+  return FindOrMake({Kind::kCyclic, num_items, item_size, 1, {}, num_ranks}, [&] {
+    return std::shared_ptr<const Distribution>(new Distribution(Kind::kCyclic, num_items, item_size, 1,
+                                                                BlockCyclicCounts(num_items, num_ranks, 1)));
+  });
+}
+
+std::shared_ptr<const ppc::core::Distribution> ppc::core::Distribution::BlockCyclic(size_t num_items, int num_ranks,
+                                                                                    size_t block, size_t item_size) {
+  CheckShape(num_items, num_ranks, item_size);
+  if (block == 0) {
+    throw std::invalid_argument("Block of a block cyclic distribution must not be empty");
+  }
+  return FindOrMake({Kind::kBlockCyclic, num_items, item_size, block, {}, num_ranks}, [&] {
+    return std::shared_ptr<const Distribution>(new Distribution(Kind::kBlockCyclic, num_items, item_size, block,
+                                                                BlockCyclicCounts(num_items, num_ranks, block)));
+  });
+}
+
+std::shared_ptr<const ppc::core::Distribution> ppc::core::Distribution::Weighted(size_t num_items,
+                                                                                 const std::vector<double> &weights,
+                                                                                 size_t item_size) {
+  CheckShape(num_items, static_cast<int>(weights.size()), item_size);
+  const double total = std::accumulate(weights.begin(), weights.end(), 0.0);
+  if (std::ranges::any_of(weights, [](double weight) { return !(weight >= 0.0) || std::isinf(weight); }) ||
+      !(total > 0.0)) {
+    throw std::invalid_argument("Weights of a distribution must be finite, not negative and not all zero");
+  }
+  return FindOrMake({Kind::kWeighted, num_items, item_size, 0, weights, static_cast<int>(weights.size())}, [&] {
+    const size_t ranks = weights.size();
+    std::vector<size_t> counts(ranks);
+    std::vector<std::pair<double, size_t>> remainders(ranks);
+    size_t assigned = 0;
+    for (size_t rank = 0; rank < ranks; rank++) {
+      const double quota = static_cast<double>(num_items) * weights[rank] / total;
+      counts[rank] = std::min(static_cast<size_t>(quota), num_items - assigned);
+      assigned += counts[rank];
+      remainders[rank] = {quota - static_cast<double>(counts[rank]), rank};
+    }
+    // the largest fractional parts take the items lost to rounding, lower ranks first on ties
+    std::ranges::stable_sort(remainders, [](const auto &a, const auto &b) { return a.first > b.first; });
+    for (size_t i = 0; assigned < num_items; i = (i + 1) % ranks) {
+      counts[remainders[i].second]++;
+      assigned++;
+    }
+    return std::shared_ptr<const Distribution>(new Distribution(Kind::kWeighted, num_items, item_size, 0, counts));
+  });
+}
+
+int ppc::core::Distribution::Owner(size_t item) const {
+  if (contiguous_) {
+    auto it = std::ranges::upper_bound(first_items_, item);
+    return static_cast<int>(it - first_items_.begin()) - 1;
+  }
+  return static_cast<int>((item / block_) % item_counts_.size());
+}
+
+size_t ppc::core::Distribution::LocalIndex(size_t item) const {
+  if (contiguous_) {
+    return item - first_items_[Owner(item)];
+  }
+  return ((item / block_ / item_counts_.size()) * block_) + (item % block_);
+}
+
+size_t ppc::core::Distribution::GlobalIndex(int rank, size_t local_item) const {
+  if (contiguous_) {
+    return first_items_[rank] + local_item;
+  }
+  const auto block_index = ((local_item / block_) * item_counts_.size()) + static_cast<size_t>(rank);
+  return (block_index * block_) + (local_item % block_);
+}
+
+std::vector<std::pair<size_t, size_t>> ppc::core::Distribution::Runs(int rank) const {
+  std::vector<std::pair<size_t, size_t>> runs;
+  if (contiguous_) {
+    if (item_counts_[rank] > 0) {
+      runs.emplace_back(first_items_[rank], item_counts_[rank]);
+    }
+    return runs;
+  }
+  const size_t stride = block_ * item_counts_.size();
+  for (size_t first = static_cast<size_t>(rank) * block_; first < num_items_; first += stride) {
+    runs.emplace_back(first, std::min(block_, num_items_ - first));
+  }
+  return runs;
+}
+
+size_t ppc::core::Distribution::CacheSize() {
+  const std::scoped_lock lock(cache_mutex);
+  return cache.size();
+}
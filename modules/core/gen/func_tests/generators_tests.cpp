@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/gen/include/generators.hpp"
+
+TEST(generators_tests, check_counter_rng_is_stateless) {
+  const ppc::core::CounterRng rng(42, 1);
+  EXPECT_EQ(rng.Bits(7), ppc::core::CounterRng(42, 1).Bits(7));
+  EXPECT_NE(rng.Bits(7), rng.Bits(8));
+  EXPECT_NE(rng.Bits(7), ppc::core::CounterRng(42, 2).Bits(7));
+  EXPECT_NE(rng.Bits(7), ppc::core::CounterRng(43, 1).Bits(7));
+  for (uint64_t i = 0; i < 1000; i++) {
+    EXPECT_LT(rng.Below(i, 10), 10U);
+    EXPECT_GE(rng.Uniform(i), 0.0);
+    EXPECT_LT(rng.Uniform(i), 1.0);
+  }
+}
+
+TEST(generators_tests, check_fill_uniform_does_not_depend_on_splitting) {
+  // parallel fill of the whole vector and a sequential element by element fill match
+  std::vector<int> data(100000);
+  ppc::core::FillUniform<int>(data, -5, 5, 123);
+  const ppc::core::CounterRng rng(123);
+  for (size_t i = 0; i < data.size(); i++) {
+    ASSERT_EQ(data[i], -5 + static_cast<int>(rng.Below(i, 11)));
+  }
+  EXPECT_EQ(*std::ranges::min_element(data), -5);
+  EXPECT_EQ(*std::ranges::max_element(data), 5);
+
+  std::vector<int> again(data.size());
+  ppc::core::FillUniform<int>(again, -5, 5, 123);
+  EXPECT_EQ(again, data);
+  ppc::core::FillUniform<int>(again, -5, 5, 124);
+  EXPECT_NE(again, data);
+}
+
+TEST(generators_tests, check_fill_uniform_real) {
+  std::vector<double> data(50000);
+  ppc::core::FillUniform(std::span(data), -1000.0, 1000.0, 1);
+  EXPECT_TRUE(std::ranges::all_of(data, [](double x) { return x >= -1000.0 && x < 1000.0; }));
+  const double mean = std::accumulate(data.begin(), data.end(), 0.0) / static_cast<double>(data.size());
+  EXPECT_NEAR(mean, 0.0, 20.0);
+}
+
+TEST(generators_tests, check_fill_normal) {
+  std::vector<double> data(100000);
+  ppc::core::FillNormal(std::span(data), 3.0, 2.0, 7);
+  const double mean = std::accumulate(data.begin(), data.end(), 0.0) / static_cast<double>(data.size());
+  double var = 0.0;
+  for (double x : data) {
+    var += (x - mean) * (x - mean);
+  }
+  var /= static_cast<double>(data.size());
+  EXPECT_NEAR(mean, 3.0, 0.05);
+  EXPECT_NEAR(std::sqrt(var), 2.0, 0.05);
+}
+
+TEST(generators_tests, check_fill_sparse) {
+  std::vector<int> data(100000);
+  ppc::core::FillSparse<int>(data, 0.1, 1, 9, 5);
+  const auto non_zero = std::ranges::count_if(data, [](int x) { return x != 0; });
+  EXPECT_NEAR(static_cast<double>(non_zero) / static_cast<double>(data.size()), 0.1, 0.01);
+  EXPECT_TRUE(std::ranges::all_of(data, [](int x) { return x >= 0 && x <= 9; }));
+}
+
+TEST(generators_tests, check_fill_diagonally_dominant) {
+  const size_t n = 64;
+  std::vector<double> matrix(n * n);
+  ppc::core::FillDiagonallyDominant(matrix, n, 11);
+  for (size_t i = 0; i < n; i++) {
+    double off_diagonal = 0.0;
+    for (size_t j = 0; j < n; j++) {
+      off_diagonal += j != i ? std::abs(matrix[(i * n) + j]) : 0.0;
+    }
+    EXPECT_GT(matrix[(i * n) + i], off_diagonal);
+  }
+  std::vector<double> wrong(n);
+  EXPECT_THROW(ppc::core::FillDiagonallyDominant(wrong, n), std::invalid_argument);
+}
+
+TEST(generators_tests, check_fill_blobs) {
+  const size_t rows = 200;
+  const size_t cols = 300;
+  std::vector<uint8_t> image(rows * cols, 7);
+  ppc::core::FillBlobs<uint8_t>(image, rows, cols, 10, 20, 0, 255, 3);
+  EXPECT_TRUE(std::ranges::all_of(image, [](uint8_t x) { return x == 0 || x == 255; }));
+  const auto foreground = std::ranges::count(image, uint8_t{255});
+  EXPECT_GT(foreground, 0);
+  EXPECT_LT(static_cast<size_t>(foreground), rows * cols);
+
+  // centers are in the image, so a blob of radius 0 is a single pixel
+  std::ranges::fill(image, 7);
+  ppc::core::FillBlobs<uint8_t>(image, rows, cols, 1, 0, 0, 255, 3);
+  EXPECT_EQ(std::ranges::count(image, uint8_t{255}), 1);
+
+  EXPECT_THROW(ppc::core::FillBlobs<uint8_t>(image, rows + 1, cols, 1, 0, 0, 255, 3), std::invalid_argument);
+  EXPECT_THROW(ppc::core::FillBlobs<uint8_t>(image, rows, cols - 1, 1, 0, 0, 255, 3), std::invalid_argument);
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "core/pool/include/thread_pool.hpp"
+
+namespace ppc::core {
+
+// Counter based generator: value number i of a stream is a hash of (seed, stream, i), so
+// any element can be produced independently and parallel fills give the same data for
+// every thread count. The hash is the SplitMix64 finalizer.
+class CounterRng {
+ public:
+  explicit CounterRng(uint64_t seed, uint64_t stream = 0) : key_(Mix(seed ^ Mix(stream + kGolden))) {}
+
+  [[nodiscard]] uint64_t Bits(uint64_t counter) const { return Mix(key_ + (counter * kGolden)); }
+  // [0, 1)
+  [[nodiscard]] double Uniform(uint64_t counter) const {
+    return static_cast<double>(Bits(counter) >> 11) * 0x1.0p-53;
+  }
+  // integer in [0, range), range 0 means the whole 64 bit range
+  [[nodiscard]] uint64_t Below(uint64_t counter, uint64_t range) const {
+    return range == 0 ? Bits(counter) : MulHigh(Bits(counter), range);
+  }
+  // standard normal value from the counters 2 * counter and 2 * counter + 1 (Box-Muller)
+  [[nodiscard]] double Normal(uint64_t counter) const {
+    const double u1 = static_cast<double>((Bits(2 * counter) >> 11) + 1) * 0x1.0p-53;
+    const double u2 = Uniform((2 * counter) + 1);
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * std::numbers::pi * u2);
+  }
+
+ private:
+  constexpr static uint64_t kGolden = 0x9E3779B97F4A7C15ULL;
+  static uint64_t Mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+  // high half of the 128 bit product, maps bits to [0, b) without division
+  static uint64_t MulHigh(uint64_t a, uint64_t b) {
+    const uint64_t a_lo = a & 0xFFFFFFFFULL;
+    const uint64_t a_hi = a >> 32;
+    const uint64_t b_lo = b & 0xFFFFFFFFULL;
+    const uint64_t b_hi = b >> 32;
+    const uint64_t mid = (a_hi * b_lo) + ((a_lo * b_lo) >> 32);
+    return (a_hi * b_hi) + (mid >> 32) + (((mid & 0xFFFFFFFFULL) + (a_lo * b_hi)) >> 32);
+  }
+
+  uint64_t key_;
+};
+
+// PPC_SEED if it is set, a fixed value otherwise, so perf inputs do not change between runs
+uint64_t GetPPCSeed();
+
+namespace detail {
+constexpr size_t kGenGrain = size_t{1} << 14;
+
+template <typename T>
+T UniformValue(const CounterRng &rng, uint64_t counter, T low, T high) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return low + static_cast<T>(rng.Uniform(counter) * static_cast<double>(high - low));
+  } else {
+    const auto range = static_cast<uint64_t>(high) - static_cast<uint64_t>(low) + 1;
+    return static_cast<T>(static_cast<uint64_t>(low) + rng.Below(counter, range));
+  }
+}
+}  // namespace detail
+
+// integers in [low, high], floating point values in [low, high)
+template <typename T>
+void FillUniform(std::span<T> data, T low, T high, uint64_t seed = GetPPCSeed(), uint64_t stream = 0) {
+  const CounterRng rng(seed, stream);
+  ThreadPool::Shared().ParallelFor(
+      0, data.size(),
+      [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          data[i] = detail::UniformValue(rng, i, low, high);
+        }
+      },
+      detail::kGenGrain);
+}
+
+template <typename T>
+void FillNormal(std::span<T> data, double mean, double stddev, uint64_t seed = GetPPCSeed(), uint64_t stream = 0) {
+  const CounterRng rng(seed, stream);
+  ThreadPool::Shared().ParallelFor(
+      0, data.size(),
+      [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          data[i] = static_cast<T>(mean + (stddev * rng.Normal(i)));
+        }
+      },
+      detail::kGenGrain);
+}
+
+// about density share of the elements uniform in [low, high] ([low, high) for floating
+// point), the others zero
+template <typename T>
+void FillSparse(std::span<T> data, double density, T low, T high, uint64_t seed = GetPPCSeed(),
+                uint64_t stream = 0) {
+  const CounterRng rng(seed, stream);
+  ThreadPool::Shared().ParallelFor(
+      0, data.size(),
+      [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          data[i] = rng.Uniform(2 * i) < density ? detail::UniformValue(rng, (2 * i) + 1, low, high) : T{};
+        }
+      },
+      detail::kGenGrain);
+}
+
+// n x n row-major matrix with off-diagonal values in [-1, 1) and a positive diagonal
+// larger than the sum of absolute values of the rest of the row
+void FillDiagonallyDominant(std::span<double> matrix, size_t n, uint64_t seed = GetPPCSeed(), uint64_t stream = 0);
+
+// rows x cols row-major image of background with num_blobs filled discs of foreground,
+// radii are up to max_radius pixels; throws std::invalid_argument if image is not rows x cols
+template <typename T>
+void FillBlobs(std::span<T> image, size_t rows, size_t cols, size_t num_blobs, size_t max_radius, T background,
+               T foreground, uint64_t seed = GetPPCSeed(), uint64_t stream = 0) {
+  if (image.size() != rows * cols) {
+    throw std::invalid_argument("FillBlobs needs a rows x cols image");
+  }
+  const CounterRng rng(seed, stream);
+  // blob b is (center row, center column, radius) from the counters 3b, 3b + 1, 3b + 2
+  auto blob = [&](size_t b, size_t k, uint64_t range) { return static_cast<int64_t>(rng.Below((3 * b) + k, range)); };
+  ThreadPool::Shared().ParallelFor(0, rows, [&](size_t row_begin, size_t row_end) {
+    for (size_t y = row_begin; y < row_end; y++) {
+      auto row = image.subspan(y * cols, cols);
+      std::ranges::fill(row, background);
+      for (size_t b = 0; b < num_blobs; b++) {
+        const int64_t cy = blob(b, 0, rows);
+        const int64_t cx = blob(b, 1, cols);
+        const int64_t r = blob(b, 2, max_radius + 1);
+        const int64_t dy = static_cast<int64_t>(y) - cy;
+        if (dy * dy > r * r) {
+          continue;
+        }
+        const auto dx = static_cast<int64_t>(std::sqrt(static_cast<double>((r * r) - (dy * dy))));
+        const auto first = static_cast<size_t>(std::max<int64_t>(cx - dx, 0));
+        const auto last = static_cast<size_t>(std::min<int64_t>(cx + dx, static_cast<int64_t>(cols) - 1));
+        std::fill(row.begin() + static_cast<std::ptrdiff_t>(first), row.begin() + static_cast<std::ptrdiff_t>(last) + 1,
+                  foreground);
+      }
+    }
+  });
+}
+
+}  // namespace ppc::core
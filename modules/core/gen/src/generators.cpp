@@ -0,0 +1,35 @@
+#include "core/gen/include/generators.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include "core/pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+uint64_t ppc::core::GetPPCSeed() {
+  const auto seed_env = ppc::util::GetEnv("PPC_SEED");
+  return !seed_env.empty() ? std::stoull(seed_env, nullptr, 0) : 0x5EED2024ULL;
+}
+
+void ppc::core::FillDiagonallyDominant(std::span<double> matrix, size_t n, uint64_t seed, uint64_t stream) {
+  if (matrix.size() != n * n) {
+    throw std::invalid_argument("FillDiagonallyDominant needs an n x n matrix");
+  }
+  const CounterRng rng(seed, stream);
+  ThreadPool::Shared().ParallelFor(0, n, [&](size_t row_begin, size_t row_end) {
+    for (size_t i = row_begin; i < row_end; i++) {
+      double row_sum = 0.0;
+      for (size_t j = 0; j < n; j++) {
+        if (j != i) {
+          matrix[(i * n) + j] = (2.0 * rng.Uniform((i * n) + j)) - 1.0;
+          row_sum += std::abs(matrix[(i * n) + j]);
+        }
+      }
+      matrix[(i * n) + i] = row_sum + 1.0 + rng.Uniform((i * n) + i);
+    }
+  });
+}
@@ -0,0 +1,305 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/graph.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+// out[i] = in[i] + 1, optionally tracks how many instances run at the same time
+class AddOneTask : public ppc::core::Task {
+ public:
+  explicit AddOneTask(ppc::core::TaskDataPtr task_data, std::atomic<int> *running = nullptr,
+                      std::atomic<int> *max_running = nullptr)
+      : Task(std::move(task_data)), running_(running), max_running_(max_running) {}
+
+  bool ValidationImpl() override { return task_data->inputs_count[0] == task_data->outputs_count[0]; }
+  bool PreProcessingImpl() override { return true; }
+  bool RunImpl() override {
+    if (running_ != nullptr) {
+      int now = ++(*running_);
+      int prev = max_running_->load();
+      while (prev < now && !max_running_->compare_exchange_weak(prev, now)) {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      --(*running_);
+    }
+    auto in = task_data->InputView<int>(0);
+    auto out = task_data->OutputView<int>(0);
+    for (size_t i = 0; i < in.Size(); i++) {
+      out[i] = in[i] + 1;
+    }
+    return true;
+  }
+  bool PostProcessingImpl() override { return true; }
+
+ private:
+  std::atomic<int> *running_;
+  std::atomic<int> *max_running_;
+};
+
+// passes Validation and PreProcessing, then Run returns false or throws
+class FailingRunTask : public ppc::core::Task {
+ public:
+  FailingRunTask(ppc::core::TaskDataPtr task_data, bool throws) : Task(std::move(task_data)), throws_(throws) {}
+
+  bool ValidationImpl() override { return true; }
+  bool PreProcessingImpl() override { return true; }
+  bool RunImpl() override {
+    if (throws_) {
+      throw std::runtime_error("run failed");
+    }
+    return false;
+  }
+  bool PostProcessingImpl() override { return true; }
+
+ private:
+  bool throws_;
+};
+
+ppc::core::TaskDataPtr MakeTaskData(std::vector<int> *in, std::vector<int> &out) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  if (in != nullptr) {
+    task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in->data()));
+    task_data->inputs_count.emplace_back(in->size());
+  }
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+  return task_data;
+}
+
+// stage of the image pipeline below, run(in, out, size) does the whole work
+class ImageStageTask : public ppc::core::Task {
+ public:
+  using Stage = std::function<void(const uint8_t *, uint8_t *, int)>;
+  ImageStageTask(ppc::core::TaskDataPtr task_data, int size, Stage stage)
+      : Task(std::move(task_data)), size_(size), stage_(std::move(stage)) {}
+
+  bool ValidationImpl() override {
+    auto pixels = static_cast<unsigned int>(size_ * size_);
+    return task_data->inputs_count[0] == pixels && task_data->outputs_count[0] == pixels;
+  }
+  bool PreProcessingImpl() override { return true; }
+  bool RunImpl() override {
+    stage_(task_data->inputs[0], task_data->outputs[0], size_);
+    return true;
+  }
+  bool PostProcessingImpl() override { return true; }
+
+ private:
+  int size_;
+  Stage stage_;
+};
+
+void StretchContrast(const uint8_t *in, uint8_t *out, int size) {
+  auto [lo, hi] = std::minmax_element(in, in + (size * size));
+  for (int i = 0; i < size * size; i++) {
+    out[i] = *hi == *lo ? 0 : static_cast<uint8_t>((in[i] - *lo) * 255 / (*hi - *lo));
+  }
+}
+
+// |gx| + |gy| of the 3x3 Sobel operator, the border is left at 0
+void DetectEdges(const uint8_t *in, uint8_t *out, int size) {
+  std::fill(out, out + (size * size), 0);
+  auto at = [&](int y, int x) { return static_cast<int>(in[(y * size) + x]); };
+  for (int y = 1; y + 1 < size; y++) {
+    for (int x = 1; x + 1 < size; x++) {
+      int gx = at(y - 1, x + 1) + (2 * at(y, x + 1)) + at(y + 1, x + 1) - at(y - 1, x - 1) - (2 * at(y, x - 1)) -
+               at(y + 1, x - 1);
+      int gy = at(y + 1, x - 1) + (2 * at(y + 1, x)) + at(y + 1, x + 1) - at(y - 1, x - 1) - (2 * at(y - 1, x)) -
+               at(y - 1, x + 1);
+      out[(y * size) + x] = static_cast<uint8_t>(std::min(std::abs(gx) + std::abs(gy), 255));
+    }
+  }
+}
+
+void Threshold(const uint8_t *in, uint8_t *out, int size) {
+  std::transform(in, in + (size * size), out, [](uint8_t v) { return v > 128 ? 1 : 0; });
+}
+
+// 4-connected components of the nonzero pixels numbered from 1
+void LabelComponents(const uint8_t *in, uint8_t *out, int size) {
+  std::fill(out, out + (size * size), 0);
+  uint8_t next = 0;
+  std::vector<int> stack;
+  for (int start = 0; start < size * size; start++) {
+    if (in[start] == 0 || out[start] != 0) {
+      continue;
+    }
+    out[start] = ++next;
+    stack.push_back(start);
+    while (!stack.empty()) {
+      int i = stack.back();
+      stack.pop_back();
+      int y = i / size;
+      int x = i % size;
+      for (auto [ny, nx] : {std::pair{y - 1, x}, std::pair{y + 1, x}, std::pair{y, x - 1}, std::pair{y, x + 1}}) {
+        int j = (ny * size) + nx;
+        if (ny >= 0 && ny < size && nx >= 0 && nx < size && in[j] != 0 && out[j] == 0) {
+          out[j] = next;
+          stack.push_back(j);
+        }
+      }
+    }
+  }
+}
+
+ppc::core::TaskDataPtr MakeOutputOnly(std::vector<uint8_t> &out) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->outputs.emplace_back(out.data());
+  task_data->outputs_count.emplace_back(out.size());
+  return task_data;
+}
+
+}  // namespace
+
+TEST(graph_tests, check_chain_without_copies) {
+  std::vector<int> in = {1, 2, 3};
+  std::vector<int> out_a(3);
+  std::vector<int> out_b(3);
+  std::vector<int> out_c(3);
+
+  ppc::core::TaskGraph graph;
+  auto a = graph.AddNode(std::make_shared<AddOneTask>(MakeTaskData(&in, out_a)));
+  auto b = graph.AddNode(std::make_shared<AddOneTask>(MakeTaskData(nullptr, out_b)));
+  auto c = graph.AddNode(std::make_shared<AddOneTask>(MakeTaskData(nullptr, out_c)));
+  // added in reverse to check the order comes from the edges
+  graph.Connect(b, 0, c, 0);
+  graph.Connect(a, 0, b, 0);
+
+  EXPECT_EQ(graph.GetTask(b)->GetData()->inputs[0], reinterpret_cast<uint8_t *>(out_a.data()));
+  EXPECT_EQ(graph.GetTask(c)->GetData()->inputs_count[0], 3U);
+  EXPECT_EQ(graph.TopologicalOrder(), std::vector<ppc::core::TaskGraph::NodeId>({a, b, c}));
+
+  ASSERT_TRUE(graph.Run(2));
+  EXPECT_EQ(out_c, std::vector<int>({4, 5, 6}));
+}
+
+TEST(graph_tests, check_independent_nodes_run_concurrently) {
+  std::atomic<int> running = 0;
+  std::atomic<int> max_running = 0;
+  std::vector<int> in = {0};
+  std::vector<std::vector<int>> outs(4, std::vector<int>(1));
+
+  ppc::core::TaskGraph graph;
+  for (auto &out : outs) {
+    graph.AddNode(std::make_shared<AddOneTask>(MakeTaskData(&in, out), &running, &max_running));
+  }
+
+  ASSERT_TRUE(graph.Run(4));
+  EXPECT_GT(max_running.load(), 1);
+  for (const auto &out : outs) {
+    EXPECT_EQ(out[0], 1);
+  }
+}
+
+TEST(graph_tests, check_failed_node_stops_successors) {
+  std::vector<int> in = {1, 2};
+  std::vector<int> wrong_out(1);
+  std::vector<int> out(2, -1);
+
+  ppc::core::TaskGraph graph;
+  auto a = graph.AddNode(std::make_shared<AddOneTask>(MakeTaskData(&in, wrong_out)));
+  auto b = graph.AddNode(std::make_shared<AddOneTask>(MakeTaskData(nullptr, out)));
+  graph.AddEdge(a, b);
+  graph.GetTask(b)->GetData()->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  graph.GetTask(b)->GetData()->inputs_count.emplace_back(in.size());
+
+  EXPECT_FALSE(graph.Run(2));
+  EXPECT_EQ(out, std::vector<int>({-1, -1}));
+}
+
+TEST(graph_tests, check_failed_node_can_run_again) {
+  for (size_t num_threads : {1, 2}) {
+    std::vector<int> in = {1, 2};
+    std::vector<int> out(2, -1);
+
+    ppc::core::TaskGraph graph;
+    graph.AddNode(std::make_shared<FailingRunTask>(std::make_shared<ppc::core::TaskData>(), false));
+    graph.AddNode(std::make_shared<AddOneTask>(MakeTaskData(&in, out)));
+
+    EXPECT_FALSE(graph.Run(num_threads));
+    EXPECT_FALSE(graph.Run(num_threads));
+  }
+}
+
+TEST(graph_tests, check_throwing_node_can_run_again) {
+  for (size_t num_threads : {1, 2}) {
+    ppc::core::TaskGraph graph;
+    graph.AddNode(std::make_shared<FailingRunTask>(std::make_shared<ppc::core::TaskData>(), true));
+
+    EXPECT_THROW(graph.Run(num_threads), std::runtime_error);
+    EXPECT_THROW(graph.Run(num_threads), std::runtime_error);
+  }
+}
+
+TEST(graph_tests, check_cycle_throws) {
+  std::vector<int> out_a(1);
+  std::vector<int> out_b(1);
+
+  ppc::core::TaskGraph graph;
+  auto a = graph.AddNode(std::make_shared<AddOneTask>(MakeTaskData(nullptr, out_a)));
+  auto b = graph.AddNode(std::make_shared<AddOneTask>(MakeTaskData(nullptr, out_b)));
+  graph.Connect(a, 0, b, 0);
+  graph.Connect(b, 0, a, 0);
+
+  EXPECT_THROW(graph.Run(), std::invalid_argument);
+  EXPECT_THROW(graph.AddEdge(a, 5), std::out_of_range);
+}
+
+TEST(graph_tests, check_image_pipeline) {
+  constexpr int kSize = 32;
+  constexpr size_t kPixels = kSize * kSize;
+  // low contrast image with two separated bright squares
+  std::vector<uint8_t> image(kPixels, 100);
+  for (int y = 0; y < kSize; y++) {
+    for (int x = 0; x < kSize; x++) {
+      bool first = y >= 4 && y < 12 && x >= 4 && x < 12;
+      bool second = y >= 20 && y < 28 && x >= 18 && x < 28;
+      if (first || second) {
+        image[(y * kSize) + x] = 120;
+      }
+    }
+  }
+  std::vector<uint8_t> stretched(kPixels);
+  std::vector<uint8_t> edges(kPixels);
+  std::vector<uint8_t> binary(kPixels);
+  std::vector<uint8_t> labels(kPixels);
+
+  auto contrast_data = MakeOutputOnly(stretched);
+  contrast_data->inputs.emplace_back(image.data());
+  contrast_data->inputs_count.emplace_back(kPixels);
+
+  ppc::core::TaskGraph graph;
+  auto contrast = graph.AddNode(std::make_shared<ImageStageTask>(contrast_data, kSize, StretchContrast));
+  auto sobel = graph.AddNode(std::make_shared<ImageStageTask>(MakeOutputOnly(edges), kSize, DetectEdges));
+  auto threshold = graph.AddNode(std::make_shared<ImageStageTask>(MakeOutputOnly(binary), kSize, Threshold));
+  auto labeling = graph.AddNode(std::make_shared<ImageStageTask>(MakeOutputOnly(labels), kSize, LabelComponents));
+  graph.Connect(contrast, 0, sobel, 0);
+  graph.Connect(sobel, 0, threshold, 0);
+  graph.Connect(threshold, 0, labeling, 0);
+
+  // the pool built by the first run is reused by the second one
+  for (size_t num_threads : {2, 2, 1}) {
+    std::ranges::fill(labels, 0);
+    ASSERT_TRUE(graph.Run(num_threads));
+    EXPECT_EQ(*std::ranges::max_element(stretched), 255);
+    // the outlines of the two squares are the only components
+    EXPECT_EQ(*std::ranges::max_element(labels), 2);
+    for (size_t i = 0; i < kPixels; i++) {
+      EXPECT_EQ(labels[i] != 0, binary[i] == 1);
+    }
+  }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "core/pool/include/thread_pool.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// DAG of tasks. Every node runs its whole Validation -> PreProcessing -> Run ->
+// PostProcessing pipeline once all its predecessors are done, nodes that do not
+// depend on each other run concurrently.
+class TaskGraph {
+ public:
+  using NodeId = size_t;
+
+  NodeId AddNode(const std::shared_ptr<Task> &task);
+  // run `to` after `from`
+  void AddEdge(NodeId from, NodeId to);
+  // use output buffer `output_index` of `from` as input `input_index` of `to` without copying it
+  // (inputs/inputs_count of `to` are extended if needed), implies AddEdge(from, to)
+  void Connect(NodeId from, size_t output_index, NodeId to, size_t input_index);
+
+  // throws std::invalid_argument if the graph has a cycle
+  [[nodiscard]] std::vector<NodeId> TopologicalOrder() const;
+  // false if any phase of any node failed, nodes not started by then are skipped;
+  // graphs of MPI tasks have to run with a single thread. The worker pool is kept
+  // between calls and only rebuilt when num_threads changes
+  bool Run(size_t num_threads = 1);
+
+  [[nodiscard]] size_t Size() const { return nodes_.size(); }
+  [[nodiscard]] const std::shared_ptr<Task> &GetTask(NodeId id) const { return nodes_.at(id).task; }
+
+ private:
+  struct Node {
+    std::shared_ptr<Task> task;
+    std::vector<NodeId> successors;
+    size_t num_predecessors = 0;
+  };
+
+  static bool RunTask(Task &task);
+  void CheckNode(NodeId id) const;
+
+  std::vector<Node> nodes_;
+  std::unique_ptr<ThreadPool> pool_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,165 @@
+#include "core/graph/include/graph.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/pool/include/thread_pool.hpp"
+#include "core/task/include/task.hpp"
+
+ppc::core::TaskGraph::NodeId ppc::core::TaskGraph::AddNode(const std::shared_ptr<Task> &task) {
+  if (!task) {
+    throw std::invalid_argument("TaskGraph node can not be empty");
+  }
+  nodes_.push_back({.task = task, .successors = {}, .num_predecessors = 0});
+  return nodes_.size() - 1;
+}
+
+void ppc::core::TaskGraph::CheckNode(NodeId id) const {
+  if (id >= nodes_.size()) {
+    throw std::out_of_range("TaskGraph has no node " + std::to_string(id));
+  }
+}
+
+void ppc::core::TaskGraph::AddEdge(NodeId from, NodeId to) {
+  CheckNode(from);
+  CheckNode(to);
+  auto &successors = nodes_[from].successors;
+  if (std::ranges::find(successors, to) == successors.end()) {
+    successors.push_back(to);
+    nodes_[to].num_predecessors++;
+  }
+}
+
+void ppc::core::TaskGraph::Connect(NodeId from, size_t output_index, NodeId to, size_t input_index) {
+  CheckNode(from);
+  CheckNode(to);
+  auto producer = nodes_[from].task->GetData();
+  auto consumer = nodes_[to].task->GetData();
+  if (output_index >= producer->outputs.size() || output_index >= producer->outputs_count.size()) {
+    throw std::out_of_range("TaskGraph producer has no output " + std::to_string(output_index));
+  }
+  if (consumer->inputs.size() <= input_index) {
+    consumer->inputs.resize(input_index + 1, nullptr);
+  }
+  if (consumer->inputs_count.size() <= input_index) {
+    consumer->inputs_count.resize(input_index + 1, 0);
+  }
+  consumer->inputs[input_index] = producer->outputs[output_index];
+  consumer->inputs_count[input_index] = producer->outputs_count[output_index];
+  AddEdge(from, to);
+}
+
+std::vector<ppc::core::TaskGraph::NodeId> ppc::core::TaskGraph::TopologicalOrder() const {
+  std::vector<size_t> pending(nodes_.size());
+  std::queue<NodeId> ready;
+  for (NodeId id = 0; id < nodes_.size(); id++) {
+    pending[id] = nodes_[id].num_predecessors;
+    if (pending[id] == 0) {
+      ready.push(id);
+    }
+  }
+  std::vector<NodeId> order;
+  order.reserve(nodes_.size());
+  while (!ready.empty()) {
+    NodeId id = ready.front();
+    ready.pop();
+    order.push_back(id);
+    for (NodeId next : nodes_[id].successors) {
+      if (--pending[next] == 0) {
+        ready.push(next);
+      }
+    }
+  }
+  if (order.size() != nodes_.size()) {
+    throw std::invalid_argument("TaskGraph has a cycle");
+  }
+  return order;
+}
+
+bool ppc::core::TaskGraph::RunTask(Task &task) {
+  // like RunAsync, a failed node has to be ready for the next Run
+  bool res = false;
+  try {
+    res = task.Validation() && task.PreProcessing() && task.Run() && task.PostProcessing();
+  } catch (...) {
+    task.ResetOrder();
+    throw;
+  }
+  if (!res) {
+    task.ResetOrder();
+  }
+  return res;
+}
+
+bool ppc::core::TaskGraph::Run(size_t num_threads) {
+  const auto order = TopologicalOrder();
+  num_threads = std::clamp<size_t>(num_threads, 1, std::max<size_t>(nodes_.size(), 1));
+  if (num_threads == 1) {
+    return std::ranges::all_of(order, [this](NodeId id) { return RunTask(*nodes_[id].task); });
+  }
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::queue<NodeId> ready;
+  std::vector<size_t> pending(nodes_.size());
+  size_t remaining = nodes_.size();
+  bool failed = false;
+  std::exception_ptr error;
+  for (NodeId id = 0; id < nodes_.size(); id++) {
+    pending[id] = nodes_[id].num_predecessors;
+    if (pending[id] == 0) {
+      ready.push(id);
+    }
+  }
+
+  auto worker = [&] {
+    while (true) {
+      std::unique_lock lock(mutex);
+      cv.wait(lock, [&] { return !ready.empty() || remaining == 0 || failed; });
+      if (remaining == 0 || failed) {
+        return;
+      }
+      NodeId id = ready.front();
+      ready.pop();
+      lock.unlock();
+
+      bool res = false;
+      try {
+        res = RunTask(*nodes_[id].task);
+      } catch (...) {
+        lock.lock();
+        error = error ? error : std::current_exception();
+        lock.unlock();
+      }
+
+      lock.lock();
+      remaining--;
+      failed = failed || !res;
+      for (NodeId next : nodes_[id].successors) {
+        if (--pending[next] == 0) {
+          ready.push(next);
+        }
+      }
+      cv.notify_all();
+    }
+  };
+
+  if (!pool_ || pool_->Size() != num_threads) {
+    pool_ = std::make_unique<ThreadPool>(num_threads);
+  }
+  // one scheduling loop per pool thread, the calling thread runs the first one
+  pool_->ParallelFor(0, num_threads, [&](size_t, size_t) { worker(); }, 1);
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return !failed;
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "core/mem/include/alloc_stats.hpp"
+
+TEST(alloc_stats_tests, check_counts_allocations) {
+  if (!ppc::core::MemoryTracker::AllocationsAvailable()) {
+    GTEST_SKIP() << "operator new is not instrumented on this platform";
+  }
+  ppc::core::MemoryTracker tracker;
+  tracker.Start();
+  std::vector<std::unique_ptr<uint8_t[]>> blocks;
+  blocks.reserve(10);
+  for (int i = 0; i < 10; i++) {
+    blocks.emplace_back(std::make_unique<uint8_t[]>(1 << 16));
+  }
+  blocks.clear();
+  auto stats = tracker.Stop();
+
+  // the vector storage and ten blocks
+  EXPECT_EQ(stats.calls, 1U);
+  EXPECT_EQ(stats.allocations, 11U);
+  EXPECT_GE(stats.allocated_bytes, 10U << 16);
+  // all blocks were alive at the same time
+  EXPECT_GE(stats.peak_heap_bytes, 10U << 16);
+  EXPECT_GT(stats.peak_rss_bytes, 0U);
+
+  // nothing is counted without a running tracker
+  tracker.Start();
+  auto stopped = tracker.Stop();
+  auto block = std::make_unique<uint8_t[]>(100);
+  EXPECT_EQ(stopped.allocations, 0U);
+  EXPECT_EQ(stopped.peak_heap_bytes, 0U);
+}
+
+TEST(alloc_stats_tests, check_counts_other_threads) {
+  if (!ppc::core::MemoryTracker::AllocationsAvailable()) {
+    GTEST_SKIP() << "operator new is not instrumented on this platform";
+  }
+  ppc::core::MemoryTracker tracker;
+  tracker.Start();
+  std::unique_ptr<uint8_t[]> block;
+  std::thread worker([&block] { block = std::make_unique<uint8_t[]>(size_t{1} << 20); });
+  worker.join();
+  block.reset();
+  auto stats = tracker.Stop();
+  EXPECT_GE(stats.allocated_bytes, size_t{1} << 20);
+  EXPECT_GE(stats.peak_heap_bytes, size_t{1} << 20);
+}
+
+TEST(alloc_stats_tests, check_one_tracker_at_a_time) {
+  ppc::core::MemoryTracker first;
+  ppc::core::MemoryTracker second;
+  ASSERT_TRUE(first.Start());
+  // a second tracker would reset the shared peak of the first one
+  EXPECT_FALSE(second.Start());
+  EXPECT_EQ(second.Stop().calls, 0U);
+  EXPECT_EQ(first.Stop().calls, 1U);
+  EXPECT_TRUE(second.Start());
+  EXPECT_EQ(second.Stop().calls, 1U);
+}
+
+TEST(alloc_stats_tests, check_merge) {
+  ppc::core::MemoryStats total;
+  total += {.calls = 1, .allocations = 2, .allocated_bytes = 100, .peak_heap_bytes = 64, .peak_rss_bytes = 1000};
+  total += {.calls = 1, .allocations = 3, .allocated_bytes = 50, .peak_heap_bytes = 32, .peak_rss_bytes = 2000};
+  EXPECT_EQ(total.calls, 2U);
+  EXPECT_EQ(total.allocations, 5U);
+  EXPECT_EQ(total.allocated_bytes, 150U);
+  EXPECT_EQ(total.peak_heap_bytes, 64U);
+  EXPECT_EQ(total.peak_rss_bytes, 2000U);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "core/mem/include/arena.hpp"
+#include "core/task/include/task.hpp"
+
+TEST(arena_tests, check_alignment) {
+  ppc::core::BufferArena arena;
+  for (size_t slot = 0; slot < 4; slot++) {
+    auto buffer = arena.Acquire<double>(slot, 3 + slot);
+    EXPECT_EQ(buffer.size(), 3 + slot);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data()) % ppc::core::AlignedBuffer::kAlignment, 0U);
+  }
+}
+
+TEST(arena_tests, check_reuse_between_iterations) {
+  ppc::core::BufferArena arena;
+  auto first = arena.Acquire<int>(0, 100);
+  first[99] = 42;
+  for (int i = 0; i < 10; i++) {
+    auto buffer = arena.Acquire<int>(0, 50 + i);
+    EXPECT_EQ(buffer.data(), first.data());
+  }
+  EXPECT_EQ(arena.Acquire<int>(0, 100)[99], 42);
+  EXPECT_EQ(arena.NumAllocations(), 1U);
+
+  arena.Acquire<int>(0, 1000);
+  EXPECT_EQ(arena.NumAllocations(), 2U);
+  EXPECT_GE(arena.ReservedBytes(), 1000 * sizeof(int));
+
+  arena.Release();
+  EXPECT_EQ(arena.ReservedBytes(), 0U);
+}
+
+TEST(arena_tests, check_huge_page_buffer) {
+  ppc::core::BufferArena arena(true);
+  const size_t count = ppc::core::AlignedBuffer::kHugePageSize / sizeof(uint64_t);
+  auto buffer = arena.Acquire<uint64_t>(0, count);
+  for (size_t i = 0; i < count; i++) {
+    buffer[i] = i;
+  }
+  EXPECT_EQ(buffer[count - 1], count - 1);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data()) % ppc::core::AlignedBuffer::kAlignment, 0U);
+}
+
+TEST(arena_tests, check_move_buffer) {
+  ppc::core::AlignedBuffer buffer(128, false);
+  void *data = buffer.Data();
+  ppc::core::AlignedBuffer moved(std::move(buffer));
+  EXPECT_EQ(moved.Data(), data);
+  EXPECT_EQ(moved.Bytes(), 128U);
+}
+
+TEST(arena_tests, check_task_data_buffers) {
+  ppc::core::BufferArena arena;
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  auto in = arena.AddInput<float>(*task_data, 16);
+  auto out = arena.AddOutput<float>(*task_data, 8);
+
+  ASSERT_EQ(task_data->inputs.size(), 1U);
+  ASSERT_EQ(task_data->outputs.size(), 1U);
+  EXPECT_EQ(task_data->inputs[0], reinterpret_cast<uint8_t *>(in.data()));
+  EXPECT_EQ(task_data->inputs_count[0], 16U);
+  EXPECT_EQ(task_data->outputs[0], reinterpret_cast<uint8_t *>(out.data()));
+  EXPECT_EQ(task_data->outputs_count[0], 8U);
+  EXPECT_NE(in.data(), out.data());
+}
+
+TEST(arena_tests, check_task_data_count_limit) {
+  ppc::core::BufferArena arena;
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  const size_t too_many = size_t{std::numeric_limits<uint32_t>::max()} + 1;
+  EXPECT_THROW(arena.AddInput<uint8_t>(*task_data, too_many), std::length_error);
+  EXPECT_THROW(arena.AddOutput<uint8_t>(*task_data, too_many), std::length_error);
+  EXPECT_TRUE(task_data->inputs.empty());
+  EXPECT_TRUE(task_data->outputs.empty());
+  EXPECT_EQ(arena.NumAllocations(), 0U);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace ppc::core {
+
+struct MemoryStats {
+  // measured intervals merged into these values
+  uint64_t calls = 0;
+  // operator new calls and requested bytes
+  uint64_t allocations = 0;
+  uint64_t allocated_bytes = 0;
+  // highest heap usage through operator new above the usage at the start of an interval
+  uint64_t peak_heap_bytes = 0;
+  // peak resident set size of the process during an interval
+  uint64_t peak_rss_bytes = 0;
+
+  // counts are summed, peaks are the maximum over the intervals
+  MemoryStats &operator+=(const MemoryStats &other) {
+    calls += other.calls;
+    allocations += other.allocations;
+    allocated_bytes += other.allocated_bytes;
+    peak_heap_bytes = std::max(peak_heap_bytes, other.peak_heap_bytes);
+    peak_rss_bytes = std::max(peak_rss_bytes, other.peak_rss_bytes);
+    return *this;
+  }
+};
+
+// Measures allocations of all threads between Start and Stop through a replacement of
+// the global operator new/delete. The replacement changes allocation for every binary that
+// links core, so it is only built on Linux with the USE_ALLOC_TRACKING cmake option
+// (allocations are not counted otherwise). The hook costs one relaxed atomic load per
+// allocation while no tracker is running. Peak RSS resets the kernel high water mark of
+// the process when it is allowed to and falls back to samples at Start and Stop otherwise.
+// Only one tracker runs at a time in the process, Start of another one returns false.
+class MemoryTracker {
+ public:
+  MemoryTracker() = default;
+  MemoryTracker(const MemoryTracker &) = delete;
+  MemoryTracker &operator=(const MemoryTracker &) = delete;
+  ~MemoryTracker();
+
+  // false if operator new is not instrumented on this platform
+  static bool AllocationsAvailable();
+  // resident set size of the process, 0 if unknown
+  static uint64_t CurrentRss();
+
+  // false (and nothing is measured) if another tracker is running
+  bool Start();
+  // statistics since Start, empty (calls == 0) if the tracker did not start
+  MemoryStats Stop();
+
+ private:
+  bool running_ = false;
+  bool rss_reset_ = false;
+  uint64_t start_rss_ = 0;
+  uint64_t start_allocations_ = 0;
+  uint64_t start_bytes_ = 0;
+  int64_t start_live_ = 0;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Owning block of uninitialized memory aligned to kAlignment bytes. Blocks of at
+// least kHugePageSize bytes are mapped with transparent huge pages when requested (Linux).
+class AlignedBuffer {
+ public:
+  constexpr static size_t kAlignment = 64;
+  constexpr static size_t kHugePageSize = size_t{2} << 20;
+
+  AlignedBuffer() = default;
+  AlignedBuffer(size_t bytes, bool huge_pages);
+  AlignedBuffer(const AlignedBuffer &) = delete;
+  AlignedBuffer &operator=(const AlignedBuffer &) = delete;
+  AlignedBuffer(AlignedBuffer &&other) noexcept;
+  AlignedBuffer &operator=(AlignedBuffer &&other) noexcept;
+  ~AlignedBuffer();
+
+  [[nodiscard]] void *Data() const { return data_; }
+  [[nodiscard]] size_t Bytes() const { return bytes_; }
+  [[nodiscard]] bool IsHugePage() const { return huge_page_; }
+
+ private:
+  void Free();
+
+  void *data_ = nullptr;
+  size_t bytes_ = 0;
+  bool mapped_ = false;
+  bool huge_page_ = false;
+};
+
+// Numbered slots of aligned memory that keep their storage between calls, so a task
+// that acquires its buffers in PreProcessingImpl allocates only on the first iteration
+// of a perf run. Memory is not initialized: pages are placed on the NUMA node of the
+// thread that writes them first, i.e. the compute kernel, not the allocating thread.
+class BufferArena {
+ public:
+  explicit BufferArena(bool huge_pages = false) : huge_pages_(huge_pages) {}
+
+  // at least count elements of slot, contents are kept only while the slot does not grow
+  template <typename T>
+  std::span<T> Acquire(size_t slot, size_t count) {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                  "BufferArena holds trivial types only");
+    return {static_cast<T *>(Reserve(slot, count * sizeof(T))), count};
+  }
+  // acquire the next free slot and register it as an input/output buffer of task_data;
+  // throws std::length_error if count does not fit the 32 bit inputs_count/outputs_count
+  template <typename T>
+  std::span<T> AddInput(TaskData &task_data, size_t count) {
+    CheckCount(count);
+    auto buffer = Acquire<T>(buffers_.size(), count);
+    task_data.inputs.emplace_back(reinterpret_cast<uint8_t *>(buffer.data()));
+    task_data.inputs_count.emplace_back(count);
+    return buffer;
+  }
+  template <typename T>
+  std::span<T> AddOutput(TaskData &task_data, size_t count) {
+    CheckCount(count);
+    auto buffer = Acquire<T>(buffers_.size(), count);
+    task_data.outputs.emplace_back(reinterpret_cast<uint8_t *>(buffer.data()));
+    task_data.outputs_count.emplace_back(count);
+    return buffer;
+  }
+
+  // count of real allocations made since construction
+  [[nodiscard]] size_t NumAllocations() const { return num_allocations_; }
+  [[nodiscard]] size_t ReservedBytes() const;
+  void Release();
+
+ private:
+  void *Reserve(size_t slot, size_t bytes);
+  static void CheckCount(size_t count);
+
+  bool huge_pages_;
+  std::vector<AlignedBuffer> buffers_;
+  size_t num_allocations_ = 0;
+};
+
+}  // namespace ppc::core
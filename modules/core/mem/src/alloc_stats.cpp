@@ -0,0 +1,177 @@
+#include "core/mem/include/alloc_stats.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <malloc.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// set while a tracker runs, the counters below are shared by all trackers
+std::atomic<bool> tracker_active = false;
+std::atomic<uint64_t> allocations = 0;
+std::atomic<uint64_t> allocated_bytes = 0;
+// usable bytes allocated minus freed while a tracker runs, may go below zero
+std::atomic<int64_t> live_bytes = 0;
+std::atomic<int64_t> peak_live_bytes = 0;
+
+#if defined(__linux__) && defined(PPC_ALLOC_TRACKING)
+
+void RecordAllocation(void *ptr, size_t size) {
+  if (!tracker_active.load(std::memory_order_relaxed)) {
+    return;
+  }
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  const auto live = live_bytes.fetch_add(static_cast<int64_t>(malloc_usable_size(ptr)), std::memory_order_relaxed) +
+                    static_cast<int64_t>(malloc_usable_size(ptr));
+  auto peak = peak_live_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+void RecordFree(void *ptr) {
+  if (ptr != nullptr && tracker_active.load(std::memory_order_relaxed)) {
+    live_bytes.fetch_sub(static_cast<int64_t>(malloc_usable_size(ptr)), std::memory_order_relaxed);
+  }
+}
+
+void *Allocate(size_t size, size_t alignment) {
+  size = std::max<size_t>(size, 1);
+  while (true) {
+    // aligned_alloc needs a multiple of the alignment
+    void *ptr = alignment == 0 ? std::malloc(size)
+                               : std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    if (ptr != nullptr) {
+      RecordAllocation(ptr, size);
+      return ptr;
+    }
+    auto handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void Free(void *ptr) {
+  RecordFree(ptr);
+  std::free(ptr);
+}
+
+#endif
+
+#ifdef __linux__
+
+// "VmHWM:  1234 kB" line of /proc/self/status
+uint64_t ReadPeakRss() {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.starts_with("VmHWM:")) {
+      std::istringstream value(line.substr(6));
+      uint64_t kb = 0;
+      value >> kb;
+      return kb * 1024;
+    }
+  }
+  return 0;
+}
+
+// resets VmHWM to the current RSS (Linux 4.0+)
+bool ResetPeakRss() {
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+  clear_refs.flush();
+  return clear_refs.good();
+}
+
+#endif
+
+}  // namespace
+
+#if defined(__linux__) && defined(PPC_ALLOC_TRACKING)
+
+// replacements of the global allocation functions, the array and nothrow forms of the
+// standard library forward to these
+void *operator new(size_t size) { return Allocate(size, 0); }
+void *operator new(size_t size, std::align_val_t alignment) { return Allocate(size, static_cast<size_t>(alignment)); }
+void operator delete(void *ptr) noexcept { Free(ptr); }
+void operator delete(void *ptr, size_t /*size*/) noexcept { Free(ptr); }
+void operator delete(void *ptr, std::align_val_t /*alignment*/) noexcept { Free(ptr); }
+void operator delete(void *ptr, size_t /*size*/, std::align_val_t /*alignment*/) noexcept { Free(ptr); }
+
+#endif
+
+ppc::core::MemoryTracker::~MemoryTracker() {
+  if (running_) {
+    tracker_active.store(false);
+  }
+}
+
+bool ppc::core::MemoryTracker::AllocationsAvailable() {
+#if defined(__linux__) && defined(PPC_ALLOC_TRACKING)
+  return true;
+#else
+  return false;
+#endif
+}
+
+uint64_t ppc::core::MemoryTracker::CurrentRss() {
+#ifdef __linux__
+  std::ifstream statm("/proc/self/statm");
+  uint64_t size = 0;
+  uint64_t resident = 0;
+  if (statm >> size >> resident) {
+    return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  }
+#endif
+  return 0;
+}
+
+bool ppc::core::MemoryTracker::Start() {
+  bool idle = false;
+  if (!running_ && !tracker_active.compare_exchange_strong(idle, true)) {
+    return false;
+  }
+  running_ = true;
+#ifdef __linux__
+  rss_reset_ = ResetPeakRss();
+#endif
+  start_rss_ = CurrentRss();
+  start_allocations_ = allocations.load();
+  start_bytes_ = allocated_bytes.load();
+  start_live_ = live_bytes.load();
+  peak_live_bytes.store(start_live_);
+  return true;
+}
+
+ppc::core::MemoryStats ppc::core::MemoryTracker::Stop() {
+  MemoryStats stats;
+  if (!running_) {
+    return stats;
+  }
+  stats.calls = 1;
+  stats.allocations = allocations.load() - start_allocations_;
+  stats.allocated_bytes = allocated_bytes.load() - start_bytes_;
+  stats.peak_heap_bytes = static_cast<uint64_t>(std::max<int64_t>(peak_live_bytes.load() - start_live_, 0));
+  stats.peak_rss_bytes = std::max(start_rss_, CurrentRss());
+#ifdef __linux__
+  if (rss_reset_) {
+    stats.peak_rss_bytes = std::max(stats.peak_rss_bytes, ReadPeakRss());
+  }
+#endif
+  tracker_active.store(false);
+  running_ = false;
+  return stats;
+}
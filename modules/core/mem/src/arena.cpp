@@ -0,0 +1,117 @@
+#include "core/mem/include/arena.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+size_t RoundUp(size_t value, size_t multiple) { return (value + multiple - 1) / multiple * multiple; }
+
+}  // namespace
+
+ppc::core::AlignedBuffer::AlignedBuffer(size_t bytes, bool huge_pages) {
+  if (bytes == 0) {
+    return;
+  }
+#ifdef __linux__
+  if (huge_pages && bytes >= kHugePageSize) {
+    const size_t mapped_bytes = RoundUp(bytes, kHugePageSize);
+    void *data = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data != MAP_FAILED) {
+      data_ = data;
+      bytes_ = mapped_bytes;
+      mapped_ = true;
+      // transparent huge pages, silently ignored if THP is disabled
+      huge_page_ = madvise(data_, bytes_, MADV_HUGEPAGE) == 0;
+      return;
+    }
+  }
+#else
+  static_cast<void>(huge_pages);
+#endif
+  const size_t aligned_bytes = RoundUp(bytes, kAlignment);
+#ifdef _WIN32
+  data_ = _aligned_malloc(aligned_bytes, kAlignment);
+#else
+  data_ = std::aligned_alloc(kAlignment, aligned_bytes);
+#endif
+  if (data_ == nullptr) {
+    throw std::bad_alloc();
+  }
+  bytes_ = aligned_bytes;
+}
+
+ppc::core::AlignedBuffer::AlignedBuffer(AlignedBuffer &&other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      bytes_(std::exchange(other.bytes_, 0)),
+      mapped_(std::exchange(other.mapped_, false)),
+      huge_page_(std::exchange(other.huge_page_, false)) {}
+
+ppc::core::AlignedBuffer &ppc::core::AlignedBuffer::operator=(AlignedBuffer &&other) noexcept {
+  if (this != &other) {
+    Free();
+    data_ = std::exchange(other.data_, nullptr);
+    bytes_ = std::exchange(other.bytes_, 0);
+    mapped_ = std::exchange(other.mapped_, false);
+    huge_page_ = std::exchange(other.huge_page_, false);
+  }
+  return *this;
+}
+
+ppc::core::AlignedBuffer::~AlignedBuffer() { Free(); }
+
+void ppc::core::AlignedBuffer::Free() {
+  if (data_ == nullptr) {
+    return;
+  }
+#ifdef __linux__
+  if (mapped_) {
+    munmap(data_, bytes_);
+    data_ = nullptr;
+    return;
+  }
+#endif
+#ifdef _WIN32
+  _aligned_free(data_);
+#else
+  std::free(data_);
+#endif
+  data_ = nullptr;
+}
+
+void *ppc::core::BufferArena::Reserve(size_t slot, size_t bytes) {
+  if (slot >= buffers_.size()) {
+    buffers_.resize(slot + 1);
+  }
+  auto &buffer = buffers_[slot];
+  if (buffer.Bytes() < bytes) {
+    buffer = AlignedBuffer(bytes, huge_pages_);
+    num_allocations_++;
+  }
+  return buffer.Data();
+}
+
+void ppc::core::BufferArena::CheckCount(size_t count) {
+  if (count > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("Buffer has more elements than inputs_count/outputs_count can hold");
+  }
+}
+
+size_t ppc::core::BufferArena::ReservedBytes() const {
+  size_t bytes = 0;
+  for (const auto &buffer : buffers_) {
+    bytes += buffer.Bytes();
+  }
+  return bytes;
+}
+
+void ppc::core::BufferArena::Release() { buffers_.clear(); }
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/baseline.hpp"
+#include "core/perf/include/perf.hpp"
+
+namespace {
+
+std::vector<double> MakeSamples(double base, size_t count) {
+  std::vector<double> samples(count);
+  for (size_t i = 0; i < count; i++) {
+    samples[i] = base + (0.001 * static_cast<double>(i % 5));
+  }
+  return samples;
+}
+
+}  // namespace
+
+TEST(baseline_tests, check_compare_detects_slowdown) {
+  auto res = ppc::core::PerfBaseline::Compare(MakeSamples(0.1, 10), MakeSamples(0.12, 10));
+
+  EXPECT_TRUE(res.available);
+  EXPECT_NEAR(res.change, 0.2, 0.01);
+  EXPECT_DOUBLE_EQ(res.u, 100.0);
+  EXPECT_LT(res.p_value, ppc::core::PerfBaseline::kAlpha);
+  EXPECT_TRUE(res.regression);
+}
+
+TEST(baseline_tests, check_compare_same_distribution) {
+  auto res = ppc::core::PerfBaseline::Compare(MakeSamples(0.1, 10), MakeSamples(0.1, 10));
+
+  EXPECT_TRUE(res.available);
+  EXPECT_DOUBLE_EQ(res.change, 0.0);
+  EXPECT_DOUBLE_EQ(res.u, 50.0);
+  EXPECT_GT(res.p_value, 0.4);
+  EXPECT_FALSE(res.regression);
+}
+
+TEST(baseline_tests, check_compare_speedup_is_not_regression) {
+  auto res = ppc::core::PerfBaseline::Compare(MakeSamples(0.12, 10), MakeSamples(0.1, 10));
+
+  EXPECT_LT(res.change, 0.0);
+  EXPECT_GT(res.p_value, 0.99);
+  EXPECT_FALSE(res.regression);
+}
+
+TEST(baseline_tests, check_compare_empty) {
+  auto res = ppc::core::PerfBaseline::Compare({}, MakeSamples(0.1, 10));
+
+  EXPECT_FALSE(res.available);
+  EXPECT_FALSE(res.regression);
+}
+
+TEST(baseline_tests, check_record_and_load) {
+  auto path = (std::filesystem::temp_directory_path() / "ppc_baseline_tests.txt").string();
+  std::filesystem::remove(path);
+  EXPECT_TRUE(ppc::core::PerfBaseline::Load(path).empty());
+
+  ppc::core::PerfResults perf_results;
+  perf_results.backend = "seq";
+  perf_results.task_name = "example";
+  perf_results.type_of_running = ppc::core::PerfResults::kPipeline;
+  perf_results.samples = {0.1, 1.0 / 3.0};
+  ppc::core::PerfBaseline::Record(path, perf_results);
+  perf_results.type_of_running = ppc::core::PerfResults::kTaskRun;
+  ppc::core::PerfBaseline::Record(path, perf_results);
+  perf_results.samples = {0.2};
+  ppc::core::PerfBaseline::Record(path, perf_results);
+
+  auto entries = ppc::core::PerfBaseline::Load(path);
+  ASSERT_EQ(entries.size(), 2U);
+  EXPECT_EQ(entries["seq/example/pipeline/np1/t1"], std::vector<double>({0.1, 1.0 / 3.0}));
+  EXPECT_EQ(entries["seq/example/task_run/np1/t1"], std::vector<double>({0.2}));
+
+  std::filesystem::remove(path);
+}
+
+TEST(baseline_tests, check_unknown_version_throws) {
+  auto path = (std::filesystem::temp_directory_path() / "ppc_baseline_tests_version.txt").string();
+  {
+    std::ofstream file(path);
+    file << "ppc-perf-baseline 999\n";
+  }
+
+  EXPECT_THROW(ppc::core::PerfBaseline::Load(path), std::runtime_error);
+
+  std::filesystem::remove(path);
+}
@@ -1,14 +1,41 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <vector>
 
 #include "core/perf/func_tests/test_task.hpp"
+#include "core/perf/include/hw_counters.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 
+namespace {
+
+// copies its input in PreProcessing like most tasks do
+class CopyingTask : public ppc::test::perf::TestTask<uint32_t> {
+ public:
+  explicit CopyingTask(const ppc::core::TaskDataPtr &task_data) : TestTask(task_data) {}
+
+  bool PreProcessingImpl() override {
+    auto *input = reinterpret_cast<uint32_t *>(task_data->inputs[0]);
+    copy_.assign(input, input + task_data->inputs_count[0]);
+    return TestTask::PreProcessingImpl();
+  }
+
+  bool PostProcessingImpl() override {
+    std::vector<uint32_t>().swap(copy_);
+    return true;
+  }
+
+ private:
+  std::vector<uint32_t> copy_;
+};
+
+}  // namespace
+
 TEST(perf_tests, check_perf_pipeline) {
   // Create data
   std::vector<uint32_t> in(2000, 1);
@@ -108,6 +135,8 @@ TEST(perf_tests, check_perf_pipeline_uint8_t_slow_test) {
   ASSERT_ANY_THROW(ppc::core::Perf::PrintPerfStatistic(perf_results));
   ASSERT_GE(perf_results->time_sec, ppc::core::PerfResults::kMaxTime);
   EXPECT_EQ(out[0], in.size());
+  // tools timing large inputs report without the limit
+  EXPECT_NO_THROW(ppc::core::Perf::ReportPerfStatistic(perf_results));
 }
 
 TEST(perf_tests, check_perf_task) {
@@ -175,3 +204,320 @@ TEST(perf_tests, check_perf_task_float) {
   ASSERT_LE(perf_results->time_sec, ppc::core::PerfResults::kMaxTime);
   EXPECT_EQ(out[0], in.size());
 }
+
+TEST(perf_tests, check_perf_samples_with_warmup) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes: every timer call advances time by one second
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  perf_attr->num_warmup = 3;
+  int timer_calls = 0;
+  perf_attr->current_timer = [&] { return static_cast<double>(timer_calls++); };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+
+  // Warm-up runs are not timed
+  EXPECT_EQ(timer_calls, 10);
+  ASSERT_EQ(perf_results->samples.size(), 5U);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 5.0);
+  EXPECT_DOUBLE_EQ(perf_results->stats.median, 1.0);
+  EXPECT_DOUBLE_EQ(perf_results->stats.stddev, 0.0);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_timer_overhead_subtracted) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes: a fake MPI_Wtime whose only cost is a quarter second per read
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 4;
+  perf_attr->timer = ppc::core::TimerKind::kMpiWtime;
+  perf_attr->mpi_wtime = [] {
+    static double now = 0.0;
+    return now += 0.25;
+  };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  EXPECT_EQ(perf_results->timer, ppc::core::TimerKind::kMpiWtime);
+  EXPECT_DOUBLE_EQ(perf_results->timer_overhead, 0.25);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 0.0);
+
+  perf_attr->subtract_timer_overhead = false;
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  EXPECT_DOUBLE_EQ(perf_results->timer_overhead, 0.0);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 1.0);
+
+  // a real clock measures a positive time
+  perf_attr->timer = ppc::core::TimerKind::kSteady;
+  perf_attr->subtract_timer_overhead = true;
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  EXPECT_EQ(perf_results->timer, ppc::core::TimerKind::kSteady);
+  EXPECT_GT(perf_results->time_sec, 0.0);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_stats) {
+  std::vector<double> samples = {5.0, 1.0, 4.0, 2.0, 3.0, 10.0, 6.0, 8.0, 7.0, 9.0};
+
+  auto stats = ppc::core::Perf::CalculateStats(samples);
+
+  EXPECT_DOUBLE_EQ(stats.min, 1.0);
+  EXPECT_DOUBLE_EQ(stats.max, 10.0);
+  EXPECT_DOUBLE_EQ(stats.mean, 5.5);
+  EXPECT_DOUBLE_EQ(stats.median, 5.5);
+  EXPECT_DOUBLE_EQ(stats.p90, 9.1);
+  EXPECT_NEAR(stats.p99, 9.91, 1e-12);
+  EXPECT_NEAR(stats.stddev, 3.0276503540974917, 1e-12);
+}
+
+TEST(perf_tests, check_perf_stats_empty) {
+  auto stats = ppc::core::Perf::CalculateStats({});
+
+  EXPECT_DOUBLE_EQ(stats.min, 0.0);
+  EXPECT_DOUBLE_EQ(stats.max, 0.0);
+  EXPECT_DOUBLE_EQ(stats.stddev, 0.0);
+}
+
+TEST(perf_tests, check_perf_pipeline_phases) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 4;
+  perf_attr->num_warmup = 2;
+  perf_attr->profile_phases = true;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  for (const auto &phase_samples : perf_results->phase_samples) {
+    EXPECT_EQ(phase_samples.size(), 4U);
+  }
+  EXPECT_GE(perf_results->phase_stats[ppc::core::Task::kRun].max, 0.0);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_task_phases) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  perf_attr->profile_phases = true;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+
+  // Only Run() is called inside the timed loop
+  EXPECT_TRUE(perf_results->phase_samples[ppc::core::Task::kValidation].empty());
+  EXPECT_EQ(perf_results->phase_samples[ppc::core::Task::kRun].size(), 3U);
+  EXPECT_TRUE(perf_results->phase_samples[ppc::core::Task::kPostProcessing].empty());
+}
+
+TEST(perf_tests, check_perf_hw_counters) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  perf_attr->use_hw_counters = true;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  EXPECT_EQ(out[0], in.size());
+
+  const auto &counters = perf_results->hw_counters;
+  if (!counters.available[ppc::core::HwCounterValues::kInstructions]) {
+    GTEST_SKIP() << "Hardware counters are not accessible on this machine";
+  }
+  // The task sums 2000 elements per iteration
+  EXPECT_GT(counters.values[ppc::core::HwCounterValues::kInstructions], 10U * in.size());
+}
+
+TEST(perf_tests, check_hw_counters_ipc) {
+  ppc::core::HwCounterValues counters;
+  EXPECT_FALSE(counters.AnyAvailable());
+  EXPECT_DOUBLE_EQ(counters.Ipc(), 0.0);
+
+  counters.values[ppc::core::HwCounterValues::kCycles] = 400;
+  counters.values[ppc::core::HwCounterValues::kInstructions] = 1000;
+  counters.available[ppc::core::HwCounterValues::kCycles] = true;
+  counters.available[ppc::core::HwCounterValues::kInstructions] = true;
+  EXPECT_TRUE(counters.AnyAvailable());
+  EXPECT_DOUBLE_EQ(counters.Ipc(), 2.5);
+}
+
+TEST(perf_tests, check_perf_rank_gather) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes: every timer call advances time by one second
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 2;
+  perf_attr->profile_phases = true;
+  int timer_calls = 0;
+  perf_attr->current_timer = [&] { return static_cast<double>(timer_calls++); };
+
+  // Emulate 3 ranks: this one and two others that took 1 and 6 seconds
+  perf_attr->rank_gather = [](const std::vector<double> &local) {
+    const size_t n = local.size();
+    std::vector<double> all(3 * n, 0.0);
+    std::ranges::copy(local, all.begin());
+    all[n] = 1.0;
+    all[2 * n] = 6.0;
+    all[(2 * n) + 1 + ppc::core::Task::kRun] = 5.0;
+    return all;
+  };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  const auto &ranks = perf_results->ranks;
+  ASSERT_EQ(ranks.per_rank.size(), 3U);
+  EXPECT_EQ(perf_results->num_processes, 3);
+  EXPECT_DOUBLE_EQ(ranks.per_rank[0], 2.0);
+  EXPECT_DOUBLE_EQ(ranks.min, 1.0);
+  EXPECT_DOUBLE_EQ(ranks.max, 6.0);
+  EXPECT_DOUBLE_EQ(ranks.mean, 3.0);
+  EXPECT_DOUBLE_EQ(ranks.imbalance, 2.0);
+  ASSERT_EQ(ranks.phase_per_rank[ppc::core::Task::kRun].size(), 3U);
+  EXPECT_DOUBLE_EQ(ranks.phase_per_rank[ppc::core::Task::kRun][2], 5.0);
+}
+
+TEST(perf_tests, check_perf_memory) {
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto test_task = std::make_shared<CopyingTask>(task_data);
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  perf_attr->profile_memory = true;
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  EXPECT_EQ(out[0], in.size());
+
+  // memory is measured on one untimed iteration after the timed ones
+  const auto &pre_processing = perf_results->phase_memory[ppc::core::Task::kPreProcessing];
+  EXPECT_EQ(pre_processing.calls, 1U);
+  EXPECT_GT(pre_processing.peak_rss_bytes, 0U);
+  // phase times are recorded only with profile_phases
+  EXPECT_TRUE(perf_results->phase_samples[ppc::core::Task::kRun].empty());
+  if (!ppc::core::MemoryTracker::AllocationsAvailable()) {
+    GTEST_SKIP() << "operator new is not instrumented on this platform";
+  }
+  EXPECT_EQ(pre_processing.allocations, 1U);
+  EXPECT_EQ(pre_processing.allocated_bytes, in.size() * sizeof(uint32_t));
+  EXPECT_GE(pre_processing.peak_heap_bytes, in.size() * sizeof(uint32_t));
+  EXPECT_EQ(perf_results->phase_memory[ppc::core::Task::kRun].allocations, 0U);
+}
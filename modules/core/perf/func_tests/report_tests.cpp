@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/report.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+ppc::core::PerfResults MakeResults() {
+  ppc::core::PerfResults perf_results;
+  perf_results.task_name = "example";
+  perf_results.backend = "seq";
+  perf_results.type_of_running = ppc::core::PerfResults::kPipeline;
+  perf_results.num_processes = 4;
+  perf_results.num_threads = 2;
+  perf_results.input_size = 1000;
+  perf_results.samples = {0.5, 0.25, 0.25};
+  perf_results.time_sec = 1.0;
+  perf_results.stats = ppc::core::Perf::CalculateStats(perf_results.samples);
+  perf_results.phase_samples[ppc::core::Task::kRun] = {0.125};
+  perf_results.phase_stats[ppc::core::Task::kRun] = ppc::core::Perf::CalculateStats({0.125});
+  return perf_results;
+}
+
+std::vector<std::string> ReadLines(const std::string &path) {
+  std::vector<std::string> lines;
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+}  // namespace
+
+TEST(report_tests, check_json_record) {
+  auto json = ppc::core::PerfReport::ToJson(MakeResults());
+
+  EXPECT_NE(json.find(R"("backend": "seq")"), std::string::npos);
+  EXPECT_NE(json.find(R"("task": "example")"), std::string::npos);
+  EXPECT_NE(json.find(R"("mode": "pipeline")"), std::string::npos);
+  EXPECT_NE(json.find(R"("num_processes": 4)"), std::string::npos);
+  EXPECT_NE(json.find(R"("input_size": 1000)"), std::string::npos);
+  EXPECT_NE(json.find(R"("median": 0.25)"), std::string::npos);
+  EXPECT_NE(json.find(R"("samples": [0.5, 0.25, 0.25])"), std::string::npos);
+  EXPECT_NE(json.find(R"("phase_Run": {"calls": 1)"), std::string::npos);
+  EXPECT_EQ(json.find("phase_Validation"), std::string::npos);
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_EQ(json.back(), '}');
+}
+
+TEST(report_tests, check_csv_record_matches_header) {
+  auto header = ppc::core::PerfReport::GetCsvHeader();
+  auto csv = ppc::core::PerfReport::ToCsv(MakeResults());
+
+  EXPECT_EQ(std::ranges::count(header, ','), std::ranges::count(csv, ','));
+  EXPECT_EQ(csv.rfind("seq,example,pipeline,4,2,1000,3,1,", 0), 0U);
+}
+
+TEST(report_tests, check_append_csv_and_json) {
+  auto dir = std::filesystem::temp_directory_path();
+  auto csv_path = (dir / "ppc_report_tests.csv").string();
+  auto json_path = (dir / "ppc_report_tests.jsonl").string();
+  std::filesystem::remove(csv_path);
+  std::filesystem::remove(json_path);
+
+  auto perf_results = MakeResults();
+  ppc::core::PerfReport::Append(csv_path, perf_results);
+  ppc::core::PerfReport::Append(csv_path, perf_results);
+  ppc::core::PerfReport::Append(json_path, perf_results);
+
+  auto csv_lines = ReadLines(csv_path);
+  ASSERT_EQ(csv_lines.size(), 3U);
+  EXPECT_EQ(csv_lines[0], ppc::core::PerfReport::GetCsvHeader());
+  EXPECT_EQ(csv_lines[1], csv_lines[2]);
+
+  auto json_lines = ReadLines(json_path);
+  ASSERT_EQ(json_lines.size(), 1U);
+  EXPECT_EQ(json_lines[0], ppc::core::PerfReport::ToJson(perf_results));
+
+  std::filesystem::remove(csv_path);
+  std::filesystem::remove(json_path);
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+#include "core/perf/include/timer.hpp"
+
+namespace {
+
+double fake_wtime = 0.0;
+
+double FakeWtime() { return fake_wtime += 0.5; }
+
+}  // namespace
+
+TEST(timer_tests, check_builtin_timers_advance) {
+  for (auto kind : {ppc::core::TimerKind::kSteady, ppc::core::TimerKind::kMonotonicRaw, ppc::core::TimerKind::kTsc,
+                    ppc::core::TimerKind::kThreadCpu}) {
+    const ppc::core::PerfTimer timer(kind);
+    const double begin = timer.Now();
+    // busy loop: thread CPU time does not advance while sleeping
+    volatile double sink = 0.0;
+    for (int i = 0; i < 1000000; i++) {
+      sink = sink + std::sqrt(static_cast<double>(i));
+    }
+    const double end = timer.Now();
+    EXPECT_GT(end, begin) << ppc::core::PerfTimer::GetName(timer.Kind());
+    const double overhead = timer.MeasureOverhead();
+    EXPECT_GE(overhead, 0.0);
+    EXPECT_LT(overhead, 1e-4);
+  }
+}
+
+TEST(timer_tests, check_names) {
+  for (auto kind : {ppc::core::TimerKind::kCustom, ppc::core::TimerKind::kSteady,
+                    ppc::core::TimerKind::kMonotonicRaw, ppc::core::TimerKind::kTsc,
+                    ppc::core::TimerKind::kThreadCpu, ppc::core::TimerKind::kMpiWtime}) {
+    EXPECT_EQ(ppc::core::PerfTimer::FromName(ppc::core::PerfTimer::GetName(kind)), kind);
+  }
+  EXPECT_THROW(static_cast<void>(ppc::core::PerfTimer::FromName("sundial")), std::invalid_argument);
+}
+
+TEST(timer_tests, check_mpi_wtime_function) {
+  EXPECT_THROW(ppc::core::PerfTimer(ppc::core::TimerKind::kMpiWtime), std::invalid_argument);
+  const ppc::core::PerfTimer timer(ppc::core::TimerKind::kMpiWtime, FakeWtime);
+  EXPECT_EQ(timer.Kind(), ppc::core::TimerKind::kMpiWtime);
+  const double begin = timer.Now();
+  EXPECT_DOUBLE_EQ(timer.Now() - begin, 0.5);
+  // every read costs 0.5 of the fake clock
+  EXPECT_DOUBLE_EQ(timer.MeasureOverhead(), 0.5);
+}
+
+TEST(timer_tests, check_tsc_matches_steady_clock) {
+  if (!ppc::core::PerfTimer::TscAvailable()) {
+    EXPECT_EQ(ppc::core::PerfTimer(ppc::core::TimerKind::kTsc).Kind(), ppc::core::TimerKind::kMonotonicRaw);
+    GTEST_SKIP() << "no invariant TSC";
+  }
+  const ppc::core::PerfTimer tsc(ppc::core::TimerKind::kTsc);
+  const ppc::core::PerfTimer steady(ppc::core::TimerKind::kSteady);
+  EXPECT_EQ(tsc.Kind(), ppc::core::TimerKind::kTsc);
+  const double tsc_begin = tsc.Now();
+  const double steady_begin = steady.Now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  const double tsc_time = tsc.Now() - tsc_begin;
+  const double steady_time = steady.Now() - steady_begin;
+  EXPECT_NEAR(tsc_time, steady_time, steady_time * 0.05);
+}
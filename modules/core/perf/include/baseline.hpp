@@ -0,0 +1,37 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+
+namespace ppc::core {
+
+// Versioned store of per-test samples in the file named by the PPC_PERF_BASELINE
+// environment variable. With PPC_PERF_BASELINE_MODE=record the samples of every
+// perf test replace its stored entry, otherwise they are compared with it.
+class PerfBaseline {
+ public:
+  using Entries = std::map<std::string, std::vector<double>>;
+
+  constexpr static int kVersion = 1;
+  // one-sided significance level and minimal median slowdown reported as a regression
+  constexpr static double kAlpha = 0.01;
+  constexpr static double kMinSlowdown = 0.05;
+
+  // path from PPC_PERF_BASELINE, empty if baselines are disabled
+  static std::string GetBaselinePath();
+  static bool IsRecordMode();
+  // "<backend>/<task>/<mode>/np<processes>/t<threads>"
+  static std::string GetKey(const PerfResults &perf_results);
+
+  // empty if the file does not exist, throws on an unknown format version
+  static Entries Load(const std::string &path);
+  static void Save(const std::string &path, const Entries &entries);
+  // replace the entry of perf_results in the file
+  static void Record(const std::string &path, const PerfResults &perf_results);
+  static BaselineComparison Compare(const std::vector<double> &baseline, const std::vector<double> &current);
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "core/registry/include/registry.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Benchmark entry of the example task of a backend: size is the side of the square matrix,
+// the input is the identity matrix and the task has to return its square
+template <typename TaskType>
+TaskInfo ExampleBenchmark(std::string backend) {
+  return {
+      .name = "example",
+      .backend = std::move(backend),
+      .description = "square the identity matrix",
+      .default_size = 500,
+      .input_on_root_only = false,
+      .create = [](TaskDataPtr task_data) { return std::make_shared<TaskType>(std::move(task_data)); },
+      .generate =
+          [](BenchmarkCase &bench_case, size_t size) {
+            auto in = bench_case.arena.AddInput<int>(*bench_case.task_data, size * size);
+            auto out = bench_case.arena.AddOutput<int>(*bench_case.task_data, size * size);
+            std::ranges::fill(in, 0);
+            std::ranges::fill(out, 0);
+            for (size_t i = 0; i < size; i++) {
+              in[(i * size) + i] = 1;
+            }
+          },
+      .verify =
+          [](const BenchmarkCase &bench_case, size_t /*size*/) {
+            return std::ranges::equal(bench_case.task_data->InputView<int>(0),
+                                      bench_case.task_data->OutputView<int>(0));
+          },
+  };
+}
+
+}  // namespace ppc::core
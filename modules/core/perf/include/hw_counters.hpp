@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ppc::core {
+
+struct HwCounterValues {
+  enum Counter : uint8_t { kCycles, kInstructions, kLlcMisses, kBranchMisses, kDtlbMisses };
+  constexpr static size_t kNumCounters = 5;
+
+  // accumulated (multiplexing-scaled) counts, valid only if available[counter] is set
+  std::array<uint64_t, kNumCounters> values{};
+  std::array<bool, kNumCounters> available{};
+
+  [[nodiscard]] bool AnyAvailable() const;
+  // instructions per cycle, 0 if one of the counters is unavailable
+  [[nodiscard]] double Ipc() const;
+  static const char *GetCounterName(Counter counter);
+};
+
+// Group of hardware counters of the calling thread (and threads it spawns
+// afterwards) read through Linux perf_event_open. The counters form one perf
+// event group, so they are scheduled together and count the same instructions.
+// On other platforms or when the kernel refuses access every counter is
+// reported as unavailable.
+class HwCounters {
+ public:
+  HwCounters();
+  HwCounters(const HwCounters &) = delete;
+  HwCounters &operator=(const HwCounters &) = delete;
+  ~HwCounters();
+
+  // start/stop counting; counts accumulate between consecutive Start/Stop pairs
+  void Start();
+  void Stop();
+  [[nodiscard]] HwCounterValues Read() const;
+
+ private:
+  std::array<int, HwCounterValues::kNumCounters> fds_{};
+  // perf ids of the counters, used to match the values of a group read
+  std::array<uint64_t, HwCounterValues::kNumCounters> ids_{};
+  int leader_ = -1;
+};
+
+}  // namespace ppc::core
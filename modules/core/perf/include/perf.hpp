@@ -1,9 +1,14 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
+#include "core/perf/include/hw_counters.hpp"
+#include "core/perf/include/timer.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc::core {
@@ -11,12 +16,90 @@ namespace ppc::core {
 struct PerfAttr {
   // count of task's running
   uint64_t num_running;
+  // count of untimed runs executed before measurement starts
+  uint64_t num_warmup = 0;
+  // record wall time of Validation/PreProcessing/Run/PostProcessing separately
+  bool profile_phases = false;
+  // count cycles/instructions/cache, branch and TLB misses of timed iterations (Linux only)
+  bool use_hw_counters = false;
+  // record allocations, peak heap and peak RSS of every phase (see MemoryTracker) on one
+  // extra untimed iteration after the timed ones
+  bool profile_memory = false;
+  // MPI mode: gathers the same-sized vector from every rank, in rank order, on every rank
+  // (see core/perf/include/perf_mpi.hpp); per-rank times are reduced into PerfResults::ranks
+  std::function<std::vector<double>(const std::vector<double>&)> rank_gather;
+  // clock of timed iterations, kCustom calls current_timer
+  TimerKind timer = TimerKind::kCustom;
+  // subtract the measured cost of a clock read from every sample (built-in timers only)
+  bool subtract_timer_overhead = true;
+  // MPI_Wtime for TimerKind::kMpiWtime, set by UseMpiWtime (see core/perf/include/perf_mpi.hpp)
+  PerfTimer::WtimeFunction mpi_wtime = nullptr;
   std::function<double()> current_timer = [&] { return 0.0; };
 };
 
+struct PerfStats {
+  // statistics over per-iteration samples (in seconds)
+  double min = 0.0;
+  double max = 0.0;
+  double mean = 0.0;
+  double median = 0.0;
+  double p90 = 0.0;
+  double p99 = 0.0;
+  double stddev = 0.0;
+};
+
+struct RankStats {
+  // time of timed iterations of every rank (in seconds)
+  std::vector<double> per_rank;
+  double min = 0.0;
+  double max = 0.0;
+  double mean = 0.0;
+  // max / mean, 1.0 means perfectly balanced ranks
+  double imbalance = 1.0;
+  // total time of every phase per rank, indexed by Task::Phase (filled if profile_phases is set)
+  std::array<std::vector<double>, Task::kNumPhases> phase_per_rank;
+};
+
+struct BaselineComparison {
+  // set if the PPC_PERF_BASELINE file has an entry for this test
+  bool available = false;
+  double baseline_median = 0.0;
+  double current_median = 0.0;
+  // current_median / baseline_median - 1
+  double change = 0.0;
+  // one-sided Mann-Whitney test that current samples are slower than baseline ones
+  double u = 0.0;
+  double p_value = 1.0;
+  bool regression = false;
+};
+
 struct PerfResults {
   // measurement of task's time (in seconds)
   double time_sec = 0.0;
+  // time of every timed iteration (in seconds)
+  std::vector<double> samples;
+  PerfStats stats;
+  // clock the samples were taken with and the cost of one read subtracted from each of them (in seconds)
+  TimerKind timer = TimerKind::kCustom;
+  double timer_overhead = 0.0;
+  // per-phase times of timed iterations, indexed by Task::Phase (filled if profile_phases is set)
+  Task::PhaseTimes phase_samples;
+  std::array<PerfStats, Task::kNumPhases> phase_stats;
+  // hardware counters summed over timed iterations (filled if use_hw_counters is set)
+  HwCounterValues hw_counters;
+  // memory statistics of every phase of the untimed memory iteration, indexed by Task::Phase (filled if
+  // profile_memory is set)
+  Task::PhaseMemory phase_memory;
+  // aggregation over MPI ranks (filled if rank_gather is set)
+  RankStats ranks;
+  // comparison with the stored baseline (filled by PrintPerfStatistic if PPC_PERF_BASELINE is set)
+  BaselineComparison baseline;
+  // description of the run for the report sink (task and backend are taken from the gtest location if empty)
+  std::string task_name;
+  std::string backend;
+  uint64_t input_size = 0;
+  int num_processes = 1;
+  int num_threads = 1;
   enum TypeOfRunning : uint8_t { kPipeline, kTaskRun, kNone } type_of_running = kNone;
   constexpr static double kMaxTime = 10.0;
 };
@@ -33,13 +116,29 @@ class Perf {
   void PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::shared_ptr<PerfResults>& perf_results) const;
   // Check performance of task's Run() function
   void TaskRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::shared_ptr<PerfResults>& perf_results) const;
-  // Pint results for automation checkers
+  // Pint results for automation checkers, append them to the PPC_PERF_REPORT file if it is set and
+  // record or compare them with the PPC_PERF_BASELINE file (throws on a significant slowdown)
   static void PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results);
+  // same report without the PerfResults::kMaxTime limit and without throwing on a baseline
+  // regression (see perf_results->baseline.regression), for tools that time large inputs
+  static void ReportPerfStatistic(const std::shared_ptr<PerfResults>& perf_results);
+  // Calculate min/median/mean/percentiles/stddev of samples
+  static PerfStats CalculateStats(std::vector<double> samples);
 
  private:
   std::shared_ptr<Task> task_;
-  static void CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
-                        const std::shared_ptr<PerfResults>& perf_results);
+  static void GatherRanks(const std::shared_ptr<PerfAttr>& perf_attr, const std::shared_ptr<PerfResults>& perf_results);
+  // names the results, appends them to the report and compares them with the baseline,
+  // returns the task location printed in front of the time
+  static std::string RecordPerfStatistic(const std::shared_ptr<PerfResults>& perf_results);
+  static void PrintDetails(const std::string& relative_path, const std::shared_ptr<PerfResults>& perf_results);
+  static void PrintTimer(const std::shared_ptr<PerfResults>& perf_results);
+  static void PrintMemory(const std::shared_ptr<PerfResults>& perf_results);
+  static void PrintHwCounters(const std::shared_ptr<PerfResults>& perf_results);
+  static void PrintRanks(const std::shared_ptr<PerfResults>& perf_results);
+  static void PrintBaseline(const std::shared_ptr<PerfResults>& perf_results);
+  void CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
+                 const std::shared_ptr<PerfResults>& perf_results) const;
 };
 
 }  // namespace ppc::core
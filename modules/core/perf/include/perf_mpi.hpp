@@ -0,0 +1,32 @@
+#pragma once
+
+#include <boost/mpi/collectives/all_gather.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <functional>
+#include <mpi.h>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/timer.hpp"
+
+namespace ppc::core {
+
+// Rank gather for PerfAttr::rank_gather: every rank passes a vector of the same
+// size and receives the vectors of all ranks concatenated in rank order.
+inline std::function<std::vector<double>(const std::vector<double> &)> MpiRankGather(
+    const boost::mpi::communicator &world) {
+  return [world](const std::vector<double> &local) {
+    std::vector<double> all(local.size() * world.size());
+    boost::mpi::all_gather(world, local.data(), static_cast<int>(local.size()), all.data());
+    return all;
+  };
+}
+
+// Times iterations with MPI_Wtime, the clock the MPI library synchronizes between
+// ranks when MPI_WTIME_IS_GLOBAL is set.
+inline void UseMpiWtime(PerfAttr &perf_attr) {
+  perf_attr.timer = TimerKind::kMpiWtime;
+  perf_attr.mpi_wtime = [] { return MPI_Wtime(); };
+}
+
+}  // namespace ppc::core
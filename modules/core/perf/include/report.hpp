@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+#include "core/perf/include/perf.hpp"
+
+namespace ppc::core {
+
+// Machine-readable sink for perf results. Every record is appended to the file
+// named by the PPC_PERF_REPORT environment variable: CSV if the file name ends
+// with ".csv", JSON lines otherwise.
+class PerfReport {
+ public:
+  // path from PPC_PERF_REPORT, empty if the report is disabled
+  static std::string GetReportPath();
+  // append one record to the report file, CSV header is written to an empty file
+  static void Append(const std::string &path, const PerfResults &perf_results);
+
+  static std::string ToJson(const PerfResults &perf_results);
+  static std::string GetCsvHeader();
+  static std::string ToCsv(const PerfResults &perf_results);
+  static const char *GetModeName(PerfResults::TypeOfRunning type_of_running);
+};
+
+}  // namespace ppc::core
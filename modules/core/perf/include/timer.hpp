@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace ppc::core {
+
+enum class TimerKind : uint8_t {
+  // PerfAttr::current_timer, samples are taken as returned
+  kCustom,
+  kSteady,
+  // CLOCK_MONOTONIC_RAW, not slewed by NTP (Linux, steady clock elsewhere)
+  kMonotonicRaw,
+  // invariant time stamp counter calibrated against the steady clock (x86, monotonic raw clock elsewhere)
+  kTsc,
+  // CPU time of the calling thread, ignores time spent waiting (Linux, steady clock elsewhere)
+  kThreadCpu,
+  // MPI_Wtime set by UseMpiWtime (see core/perf/include/perf_mpi.hpp)
+  kMpiWtime,
+};
+
+// Built-in clock of the perf runner. Now() is a direct call without std::function, the
+// cost of a read is measured by MeasureOverhead and subtracted from every sample.
+class PerfTimer {
+ public:
+  using WtimeFunction = double (*)();
+
+  // falls back to another clock if the requested one is not available, see Kind()
+  explicit PerfTimer(TimerKind kind, WtimeFunction mpi_wtime = nullptr);
+
+  // seconds since an arbitrary origin, kCustom reads 0.0
+  [[nodiscard]] double Now() const;
+  // clock that is actually read
+  [[nodiscard]] TimerKind Kind() const { return kind_; }
+  // cost of one Now() call in seconds: the cheapest of several batches of back-to-back reads
+  [[nodiscard]] double MeasureOverhead() const;
+
+  static const char *GetName(TimerKind kind);
+  // inverse of GetName, throws std::invalid_argument on unknown names
+  static TimerKind FromName(const std::string &name);
+  // false without an invariant TSC (the counter of a CPU with frequency scaling is not a clock)
+  static bool TscAvailable();
+  // TSC ticks per second, measured once per process
+  static double TscFrequency();
+
+ private:
+  TimerKind kind_;
+  WtimeFunction mpi_wtime_;
+  double tsc_period_ = 0.0;
+  // counter value at construction, kTsc reads are relative to it
+  uint64_t tsc_origin_ = 0;
+};
+
+}  // namespace ppc::core
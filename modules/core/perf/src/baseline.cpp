@@ -0,0 +1,150 @@
+#include "core/perf/include/baseline.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <numbers>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/report.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+constexpr const char *kHeader = "ppc-perf-baseline";
+
+double Median(std::vector<double> values) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  std::ranges::sort(values);
+  size_t mid = values.size() / 2;
+  return values.size() % 2 == 1 ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+}
+
+}  // namespace
+
+std::string ppc::core::PerfBaseline::GetBaselinePath() { return ppc::util::GetEnv("PPC_PERF_BASELINE"); }
+
+bool ppc::core::PerfBaseline::IsRecordMode() { return ppc::util::GetEnv("PPC_PERF_BASELINE_MODE") == "record"; }
+
+std::string ppc::core::PerfBaseline::GetKey(const PerfResults &perf_results) {
+  return perf_results.backend + "/" + perf_results.task_name + "/" +
+         PerfReport::GetModeName(perf_results.type_of_running) + "/np" + std::to_string(perf_results.num_processes) +
+         "/t" + std::to_string(perf_results.num_threads);
+}
+
+ppc::core::PerfBaseline::Entries ppc::core::PerfBaseline::Load(const std::string &path) {
+  Entries entries;
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    return entries;
+  }
+  std::string header;
+  int version = 0;
+  if (!(file >> header >> version) || header != kHeader || version != kVersion) {
+    throw std::runtime_error("Unsupported perf baseline file: " + path);
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream line_stream(line);
+    std::string key;
+    size_t count = 0;
+    if (!(line_stream >> key >> count)) {
+      continue;
+    }
+    std::vector<double> samples(count);
+    for (auto &sample : samples) {
+      if (!(line_stream >> sample)) {
+        throw std::runtime_error("Broken perf baseline entry '" + key + "' in " + path);
+      }
+    }
+    entries[key] = std::move(samples);
+  }
+  return entries;
+}
+
+void ppc::core::PerfBaseline::Save(const std::string &path, const Entries &entries) {
+  std::ofstream file(path, std::ios_base::trunc);
+  if (!file.is_open()) {
+    throw std::runtime_error("Cannot open perf baseline file: " + path);
+  }
+  file << kHeader << " " << kVersion << '\n';
+  file << std::setprecision(std::numeric_limits<double>::max_digits10);
+  for (const auto &[key, samples] : entries) {
+    file << key << " " << samples.size();
+    for (double sample : samples) {
+      file << " " << sample;
+    }
+    file << '\n';
+  }
+}
+
+void ppc::core::PerfBaseline::Record(const std::string &path, const PerfResults &perf_results) {
+  auto entries = Load(path);
+  entries[GetKey(perf_results)] = perf_results.samples;
+  Save(path, entries);
+}
+
+ppc::core::BaselineComparison ppc::core::PerfBaseline::Compare(const std::vector<double> &baseline,
+                                                               const std::vector<double> &current) {
+  BaselineComparison res;
+  if (baseline.empty() || current.empty()) {
+    return res;
+  }
+  res.available = true;
+  res.baseline_median = Median(baseline);
+  res.current_median = Median(current);
+  res.change = res.baseline_median > 0.0 ? (res.current_median / res.baseline_median) - 1.0 : 0.0;
+
+  // rank the pooled samples, ties get the average rank
+  std::vector<std::pair<double, bool>> pooled;
+  pooled.reserve(baseline.size() + current.size());
+  for (double value : baseline) {
+    pooled.emplace_back(value, false);
+  }
+  for (double value : current) {
+    pooled.emplace_back(value, true);
+  }
+  std::ranges::sort(pooled, {}, &std::pair<double, bool>::first);
+
+  const auto n1 = static_cast<double>(baseline.size());
+  const auto n2 = static_cast<double>(current.size());
+  const auto n = n1 + n2;
+  double current_rank_sum = 0.0;
+  double tie_term = 0.0;
+  for (size_t i = 0; i < pooled.size();) {
+    size_t j = i;
+    while (j < pooled.size() && pooled[j].first == pooled[i].first) {
+      j++;
+    }
+    const double rank = (static_cast<double>(i + j) + 1.0) / 2.0;
+    for (size_t k = i; k < j; k++) {
+      if (pooled[k].second) {
+        current_rank_sum += rank;
+      }
+    }
+    const auto ties = static_cast<double>(j - i);
+    tie_term += (ties * ties * ties) - ties;
+    i = j;
+  }
+
+  // normal approximation with tie and continuity correction, H1: current samples are larger
+  res.u = current_rank_sum - (n2 * (n2 + 1.0) / 2.0);
+  const double mean_u = n1 * n2 / 2.0;
+  const double var_u = n1 * n2 / 12.0 * ((n + 1.0) - (tie_term / (n * (n - 1.0))));
+  if (var_u > 0.0) {
+    const double z = (res.u - mean_u - 0.5) / std::sqrt(var_u);
+    res.p_value = 0.5 * std::erfc(z / std::numbers::sqrt2);
+  }
+  res.regression = res.p_value < kAlpha && res.change > kMinSlowdown;
+  return res;
+}
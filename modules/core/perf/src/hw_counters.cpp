@@ -0,0 +1,157 @@
+#include "core/perf/include/hw_counters.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+#endif
+
+bool ppc::core::HwCounterValues::AnyAvailable() const {
+  for (bool is_available : available) {
+    if (is_available) {
+      return true;
+    }
+  }
+  return false;
+}
+
+double ppc::core::HwCounterValues::Ipc() const {
+  if (!available[kCycles] || !available[kInstructions] || values[kCycles] == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(values[kInstructions]) / static_cast<double>(values[kCycles]);
+}
+
+const char *ppc::core::HwCounterValues::GetCounterName(Counter counter) {
+  switch (counter) {
+    case kCycles:
+      return "cycles";
+    case kInstructions:
+      return "instructions";
+    case kLlcMisses:
+      return "LLC-misses";
+    case kBranchMisses:
+      return "branch-misses";
+    case kDtlbMisses:
+      return "dTLB-misses";
+  }
+  return "unknown";
+}
+
+#ifdef __linux__
+
+namespace {
+
+int OpenCounter(uint32_t type, uint64_t config, int group_fd) {
+  perf_event_attr attr{};
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format =
+      PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+}  // namespace
+
+ppc::core::HwCounters::HwCounters() {
+  constexpr uint64_t kDtlbReadMiss = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                     (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+  const std::array<std::pair<uint32_t, uint64_t>, HwCounterValues::kNumCounters> events = {{
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+      {PERF_TYPE_HW_CACHE, kDtlbReadMiss},
+  }};
+  // the first counter the kernel accepts leads the group, the others join it
+  for (size_t i = 0; i < HwCounterValues::kNumCounters; i++) {
+    fds_[i] = OpenCounter(events[i].first, events[i].second, leader_);
+    if (fds_[i] >= 0 && ioctl(fds_[i], PERF_EVENT_IOC_ID, &ids_[i]) != 0) {
+      close(fds_[i]);
+      fds_[i] = -1;
+    }
+    if (fds_[i] >= 0 && leader_ < 0) {
+      leader_ = fds_[i];
+    }
+  }
+}
+
+ppc::core::HwCounters::~HwCounters() {
+  // members first, the leader owns the group
+  for (int fd : fds_) {
+    if (fd >= 0 && fd != leader_) {
+      close(fd);
+    }
+  }
+  if (leader_ >= 0) {
+    close(leader_);
+  }
+}
+
+void ppc::core::HwCounters::Start() {
+  if (leader_ >= 0) {
+    ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+}
+
+void ppc::core::HwCounters::Stop() {
+  if (leader_ >= 0) {
+    ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  }
+}
+
+ppc::core::HwCounterValues ppc::core::HwCounters::Read() const {
+  HwCounterValues result;
+  if (leader_ < 0) {
+    return result;
+  }
+  // nr, time_enabled, time_running, then a {value, id} pair per counter
+  std::array<uint64_t, 3 + (2 * HwCounterValues::kNumCounters)> data{};
+  const ssize_t size = read(leader_, data.data(), sizeof(data));
+  if (size < static_cast<ssize_t>(3 * sizeof(uint64_t)) || data[2] == 0) {
+    return result;
+  }
+  const size_t nr = std::min<size_t>(data[0], HwCounterValues::kNumCounters);
+  // the whole group is multiplexed at once, so one ratio scales every value
+  const double scale = data[2] < data[1] ? static_cast<double>(data[1]) / static_cast<double>(data[2]) : 1.0;
+  for (size_t k = 0; k < nr; k++) {
+    const uint64_t value = data[3 + (2 * k)];
+    const uint64_t id = data[4 + (2 * k)];
+    for (size_t i = 0; i < HwCounterValues::kNumCounters; i++) {
+      if (fds_[i] >= 0 && ids_[i] == id) {
+        result.values[i] = static_cast<uint64_t>(static_cast<double>(value) * scale);
+        result.available[i] = true;
+      }
+    }
+  }
+  return result;
+}
+
+#else
+
+ppc::core::HwCounters::HwCounters() { fds_.fill(-1); }
+
+ppc::core::HwCounters::~HwCounters() = default;
+
+void ppc::core::HwCounters::Start() {}
+
+void ppc::core::HwCounters::Stop() {}
+
+ppc::core::HwCounterValues ppc::core::HwCounters::Read() const { return {}; }
+
+#endif
@@ -2,16 +2,67 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <filesystem>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
+#include "core/perf/include/baseline.hpp"
+#include "core/perf/include/hw_counters.hpp"
+#include "core/perf/include/report.hpp"
+#include "core/perf/include/timer.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// Value of the first environment variable set by the MPI launcher (Open MPI, MPICH/Intel MPI)
+int GetLauncherValue(const char* open_mpi_var, const char* pmi_var, int default_value) {
+  for (const char* var : {open_mpi_var, pmi_var}) {
+    const auto value = ppc::util::GetEnv(var);
+    if (!value.empty()) {
+      return std::atoi(value.c_str());
+    }
+  }
+  return default_value;
+}
+
+int GetLauncherNumProcesses() {
+  int num_processes = GetLauncherValue("OMPI_COMM_WORLD_SIZE", "PMI_SIZE", 1);
+  return num_processes > 0 ? num_processes : 1;
+}
+
+int GetLauncherRank() { return GetLauncherValue("OMPI_COMM_WORLD_RANK", "PMI_RANK", 0); }
+
+// Perf tests live in tasks/<backend>/<task>/perf_tests/, find the last "tasks" component of the path
+bool ParseTaskLocation(const std::string& file, std::string& backend, std::string& task_name) {
+  const std::filesystem::path path(file);
+  std::vector<std::string> parts;
+  for (const auto& part : path) {
+    parts.push_back(part.string());
+  }
+  for (size_t i = parts.size(); i-- > 0;) {
+    if (parts[i] == "tasks" && i + 2 < parts.size()) {
+      backend = parts[i + 1];
+      task_name = parts[i + 2];
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
 
 ppc::core::Perf::Perf(const std::shared_ptr<Task>& task_ptr) { SetTask(task_ptr); }
 
@@ -23,6 +74,7 @@ void ppc::core::Perf::SetTask(const std::shared_ptr<Task>& task_ptr) {
 void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
                                   const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kPipeline;
+  task_->SetPhaseProfiling(perf_attr->profile_phases);
 
   CommonRun(
       perf_attr,
@@ -33,11 +85,14 @@ void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
         task_->PostProcessing();
       },
       perf_results);
+
+  task_->SetPhaseProfiling(false);
 }
 
 void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
                               const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kTaskRun;
+  task_->SetPhaseProfiling(perf_attr->profile_phases);
 
   task_->Validation();
   task_->PreProcessing();
@@ -48,51 +103,358 @@ void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
   task_->PreProcessing();
   task_->Run();
   task_->PostProcessing();
+
+  task_->SetPhaseProfiling(false);
 }
 
 void ppc::core::Perf::CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
-                                const std::shared_ptr<ppc::core::PerfResults>& perf_results) {
-  auto begin = perf_attr->current_timer();
+                                const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
+  for (uint64_t i = 0; i < perf_attr->num_warmup; i++) {
+    pipeline();
+  }
+  task_->ClearPhaseTimes();
+
+  std::optional<HwCounters> hw_counters;
+  if (perf_attr->use_hw_counters) {
+    hw_counters.emplace();
+  }
+
+  const bool custom_timer = perf_attr->timer == TimerKind::kCustom;
+  const PerfTimer timer(perf_attr->timer, perf_attr->mpi_wtime);
+  perf_results->timer = timer.Kind();
+  // the cost of a custom timer is unknown, it may not even be a clock
+  perf_results->timer_overhead = !custom_timer && perf_attr->subtract_timer_overhead ? timer.MeasureOverhead() : 0.0;
+
+  perf_results->samples.clear();
+  perf_results->samples.reserve(perf_attr->num_running);
   for (uint64_t i = 0; i < perf_attr->num_running; i++) {
+    if (hw_counters) {
+      hw_counters->Start();
+    }
+    auto begin = custom_timer ? perf_attr->current_timer() : timer.Now();
+    pipeline();
+    auto end = custom_timer ? perf_attr->current_timer() : timer.Now();
+    if (hw_counters) {
+      hw_counters->Stop();
+    }
+    perf_results->samples.push_back(custom_timer ? end - begin
+                                                 : std::max(end - begin - perf_results->timer_overhead, 0.0));
+  }
+  perf_results->hw_counters = hw_counters ? hw_counters->Read() : HwCounterValues{};
+
+  // the tracker reads and writes /proc around every phase, so memory is measured on one
+  // extra iteration after the timed ones instead of inside them
+  if (perf_attr->profile_memory) {
+    task_->SetPhaseProfiling(false);
+    task_->SetMemoryProfiling(true);
     pipeline();
+    task_->SetMemoryProfiling(false);
+    task_->SetPhaseProfiling(perf_attr->profile_phases);
+  }
+
+  perf_results->input_size = 0;
+  for (auto count : task_->GetData()->inputs_count) {
+    perf_results->input_size += count;
+  }
+  perf_results->num_threads = ppc::util::GetPPCNumThreads();
+  perf_results->num_processes = GetLauncherNumProcesses();
+
+  perf_results->time_sec = 0.0;
+  for (auto sample : perf_results->samples) {
+    perf_results->time_sec += sample;
+  }
+  perf_results->stats = CalculateStats(perf_results->samples);
+
+  perf_results->phase_samples = task_->GetPhaseTimes();
+  perf_results->phase_memory = task_->GetPhaseMemory();
+  for (size_t phase = 0; phase < Task::kNumPhases; phase++) {
+    perf_results->phase_stats[phase] = CalculateStats(perf_results->phase_samples[phase]);
+  }
+
+  if (perf_attr->rank_gather) {
+    GatherRanks(perf_attr, perf_results);
   }
-  auto end = perf_attr->current_timer();
-  perf_results->time_sec = end - begin;
 }
 
-void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results) {
-  std::string relative_path(::testing::UnitTest::GetInstance()->current_test_info()->file());
+ppc::core::PerfStats ppc::core::Perf::CalculateStats(std::vector<double> samples) {
+  PerfStats stats;
+  if (samples.empty()) {
+    return stats;
+  }
+  std::ranges::sort(samples);
+
+  // Linear interpolation between closest ranks
+  auto percentile = [&samples](double q) {
+    auto pos = q * static_cast<double>(samples.size() - 1);
+    auto lower = static_cast<size_t>(std::floor(pos));
+    auto upper = std::min(lower + 1, samples.size() - 1);
+    auto frac = pos - static_cast<double>(lower);
+    return samples[lower] + ((samples[upper] - samples[lower]) * frac);
+  };
+
+  auto n = static_cast<double>(samples.size());
+  double sum = 0.0;
+  for (auto sample : samples) {
+    sum += sample;
+  }
+  stats.min = samples.front();
+  stats.max = samples.back();
+  stats.mean = sum / n;
+  stats.median = percentile(0.5);
+  stats.p90 = percentile(0.9);
+  stats.p99 = percentile(0.99);
+
+  if (samples.size() > 1) {
+    double sq_sum = 0.0;
+    for (auto sample : samples) {
+      sq_sum += (sample - stats.mean) * (sample - stats.mean);
+    }
+    stats.stddev = std::sqrt(sq_sum / (n - 1.0));
+  }
+  return stats;
+}
+
+void ppc::core::Perf::GatherRanks(const std::shared_ptr<PerfAttr>& perf_attr,
+                                  const std::shared_ptr<PerfResults>& perf_results) {
+  // local values: total time followed by total time of every phase
+  constexpr size_t kValuesPerRank = 1 + Task::kNumPhases;
+  std::vector<double> local(kValuesPerRank, 0.0);
+  local[0] = perf_results->time_sec;
+  for (size_t phase = 0; phase < Task::kNumPhases; phase++) {
+    for (auto sample : perf_results->phase_samples[phase]) {
+      local[1 + phase] += sample;
+    }
+  }
+
+  auto all = perf_attr->rank_gather(local);
+  auto& ranks = perf_results->ranks;
+  auto num_ranks = all.size() / kValuesPerRank;
+  ranks = RankStats{};
+  if (num_ranks == 0) {
+    return;
+  }
+
+  for (size_t rank = 0; rank < num_ranks; rank++) {
+    ranks.per_rank.push_back(all[rank * kValuesPerRank]);
+    if (perf_attr->profile_phases) {
+      for (size_t phase = 0; phase < Task::kNumPhases; phase++) {
+        ranks.phase_per_rank[phase].push_back(all[(rank * kValuesPerRank) + 1 + phase]);
+      }
+    }
+  }
+
+  auto [min_it, max_it] = std::ranges::minmax_element(ranks.per_rank);
+  ranks.min = *min_it;
+  ranks.max = *max_it;
+  double sum = 0.0;
+  for (auto time : ranks.per_rank) {
+    sum += time;
+  }
+  ranks.mean = sum / static_cast<double>(num_ranks);
+  ranks.imbalance = ranks.mean > 0.0 ? ranks.max / ranks.mean : 1.0;
+  perf_results->num_processes = static_cast<int>(num_ranks);
+}
+
+void ppc::core::Perf::PrintRanks(const std::shared_ptr<PerfResults>& perf_results) {
+  const auto& ranks = perf_results->ranks;
+  if (ranks.per_rank.empty()) {
+    return;
+  }
+  std::cout << std::fixed << std::setprecision(10) << "Perf ranks (" << ranks.per_rank.size()
+            << " processes, secs): min=" << ranks.min << " mean=" << ranks.mean << " max=" << ranks.max
+            << std::setprecision(3) << " imbalance=" << ranks.imbalance << '\n';
+  if (ranks.phase_per_rank[Task::kRun].empty()) {
+    return;
+  }
+  for (size_t rank = 0; rank < ranks.per_rank.size(); rank++) {
+    std::cout << "Perf rank " << rank << " phases (secs):" << std::setprecision(10);
+    for (size_t phase = 0; phase < Task::kNumPhases; phase++) {
+      std::cout << " " << Task::GetPhaseName(static_cast<Task::Phase>(phase)) << "="
+                << ranks.phase_per_rank[phase][rank];
+    }
+    std::cout << '\n';
+  }
+}
+
+void ppc::core::Perf::PrintTimer(const std::shared_ptr<PerfResults>& perf_results) {
+  if (perf_results->timer == TimerKind::kCustom) {
+    return;
+  }
+  std::cout << "Perf timer: " << PerfTimer::GetName(perf_results->timer);
+  // timer_overhead stays 0 when subtract_timer_overhead is off
+  if (perf_results->timer_overhead > 0.0) {
+    const std::ios_base::fmtflags flags = std::cout.flags();
+    const std::streamsize precision = std::cout.precision();
+    std::cout << std::fixed << std::setprecision(1) << ", overhead per read " << perf_results->timer_overhead * 1e9
+              << " ns (subtracted)";
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+  }
+  std::cout << '\n';
+}
+
+void ppc::core::Perf::PrintMemory(const std::shared_ptr<PerfResults>& perf_results) {
+  const std::ios_base::fmtflags flags = std::cout.flags();
+  const std::streamsize precision = std::cout.precision();
+  for (size_t phase = 0; phase < Task::kNumPhases; phase++) {
+    const auto& memory = perf_results->phase_memory[phase];
+    if (memory.calls == 0) {
+      continue;
+    }
+    auto calls = static_cast<double>(memory.calls);
+    std::cout << std::fixed << std::setprecision(0) << "Perf memory "
+              << Task::GetPhaseName(static_cast<Task::Phase>(phase)) << " (" << memory.calls
+              << " calls, per call): allocations=" << static_cast<double>(memory.allocations) / calls
+              << " bytes=" << static_cast<double>(memory.allocated_bytes) / calls
+              << " peak_heap=" << memory.peak_heap_bytes << " peak_rss=" << memory.peak_rss_bytes << '\n';
+  }
+  std::cout.flags(flags);
+  std::cout.precision(precision);
+}
+
+void ppc::core::Perf::PrintHwCounters(const std::shared_ptr<PerfResults>& perf_results) {
+  const auto& counters = perf_results->hw_counters;
+  if (!counters.AnyAvailable() || perf_results->samples.empty()) {
+    return;
+  }
+  const std::ios_base::fmtflags flags = std::cout.flags();
+  const std::streamsize precision = std::cout.precision();
+  auto iterations = static_cast<double>(perf_results->samples.size());
+  std::cout << "Perf counters (per iteration):";
+  for (size_t i = 0; i < HwCounterValues::kNumCounters; i++) {
+    std::cout << " " << HwCounterValues::GetCounterName(static_cast<HwCounterValues::Counter>(i)) << "=";
+    if (counters.available[i]) {
+      std::cout << std::fixed << std::setprecision(0) << static_cast<double>(counters.values[i]) / iterations;
+    } else {
+      std::cout << "n/a";
+    }
+  }
+  std::cout << " IPC=" << std::fixed << std::setprecision(3) << counters.Ipc() << '\n';
+  std::cout.flags(flags);
+  std::cout.precision(precision);
+}
+
+void ppc::core::Perf::PrintBaseline(const std::shared_ptr<PerfResults>& perf_results) {
+  const auto& baseline = perf_results->baseline;
+  if (!baseline.available) {
+    return;
+  }
+  std::cout << std::fixed << std::setprecision(10) << "Perf baseline (secs): median=" << baseline.baseline_median
+            << " current=" << baseline.current_median << std::setprecision(2) << " change=" << baseline.change * 100.0
+            << "%" << std::setprecision(6) << " U=" << baseline.u << " p=" << baseline.p_value
+            << (baseline.regression ? " REGRESSION" : "") << '\n';
+}
+
+std::string ppc::core::Perf::RecordPerfStatistic(const std::shared_ptr<PerfResults>& perf_results) {
+  const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+  // task and backend set by the caller (benchmark executables) win over the location of the test
+  const bool named = !perf_results->task_name.empty() && !perf_results->backend.empty();
+  std::string relative_path =
+      named || test_info == nullptr ? "tasks/" + perf_results->backend + "/" + perf_results->task_name
+                                    : test_info->file();
   std::string ppc_regex_template("parallel_programming_course");
   std::string perf_regex_template("perf_tests");
-  std::string type_test_name;
 
-  auto time_secs = perf_results->time_sec;
-
-  if (perf_results->type_of_running == PerfResults::TypeOfRunning::kTaskRun) {
-    type_test_name = "task_run";
-  } else if (perf_results->type_of_running == PerfResults::TypeOfRunning::kPipeline) {
-    type_test_name = "pipeline";
+  std::string backend;
+  std::string task_name;
+  if (ParseTaskLocation(relative_path, backend, task_name)) {
+    relative_path = "tasks/" + backend + "/" + task_name;
   } else {
-    type_test_name = "none";
+    auto first_found_position = relative_path.find(ppc_regex_template) + ppc_regex_template.length() + 1;
+    relative_path.erase(0, first_found_position);
+
+    auto last_found_position = relative_path.find(perf_regex_template) - 1;
+    relative_path.erase(last_found_position, relative_path.length() - 1);
+
+    backend = "unknown";
+    task_name = test_info != nullptr ? test_info->test_suite_name() : "unknown";
+  }
+  if (perf_results->task_name.empty()) {
+    perf_results->task_name = task_name;
+  }
+  if (perf_results->backend.empty()) {
+    perf_results->backend = backend;
   }
 
-  auto first_found_position = relative_path.find(ppc_regex_template) + ppc_regex_template.length() + 1;
-  relative_path.erase(0, first_found_position);
+  const auto baseline_path = PerfBaseline::GetBaselinePath();
+  if (!baseline_path.empty()) {
+    if (PerfBaseline::IsRecordMode()) {
+      if (GetLauncherRank() == 0) {
+        PerfBaseline::Record(baseline_path, *perf_results);
+      }
+    } else {
+      const auto entries = PerfBaseline::Load(baseline_path);
+      auto entry = entries.find(PerfBaseline::GetKey(*perf_results));
+      if (entry != entries.end()) {
+        perf_results->baseline = PerfBaseline::Compare(entry->second, perf_results->samples);
+      }
+    }
+  }
+
+  // several perf tests print on every process, keep a single record per run
+  const auto report_path = PerfReport::GetReportPath();
+  if (!report_path.empty() && GetLauncherRank() == 0) {
+    PerfReport::Append(report_path, *perf_results);
+  }
+  return relative_path;
+}
+
+void ppc::core::Perf::PrintDetails(const std::string& relative_path,
+                                   const std::shared_ptr<PerfResults>& perf_results) {
+  const std::ios_base::fmtflags flags = std::cout.flags();
+  const std::streamsize precision = std::cout.precision();
+  std::cout << relative_path << ":" << PerfReport::GetModeName(perf_results->type_of_running) << ":" << std::fixed
+            << std::setprecision(10) << perf_results->time_sec << '\n';
+  if (!perf_results->samples.empty()) {
+    const auto& stats = perf_results->stats;
+    std::cout << "Perf statistic (" << perf_results->samples.size() << " samples, secs): min=" << stats.min
+              << " median=" << stats.median << " mean=" << stats.mean << " p90=" << stats.p90 << " p99=" << stats.p99
+              << " max=" << stats.max << " stddev=" << stats.stddev << '\n';
+  }
+  for (size_t phase = 0; phase < Task::kNumPhases; phase++) {
+    const auto& samples = perf_results->phase_samples[phase];
+    if (samples.empty()) {
+      continue;
+    }
+    const auto& stats = perf_results->phase_stats[phase];
+    std::cout << "Perf phase " << Task::GetPhaseName(static_cast<Task::Phase>(phase)) << " (" << samples.size()
+              << " calls, secs): median=" << stats.median << " mean=" << stats.mean << " max=" << stats.max
+              << " total=" << stats.mean * static_cast<double>(samples.size()) << '\n';
+  }
+  std::cout.flags(flags);
+  std::cout.precision(precision);
+  PrintTimer(perf_results);
+  PrintMemory(perf_results);
+  PrintHwCounters(perf_results);
+  PrintRanks(perf_results);
+  PrintBaseline(perf_results);
+}
 
-  auto last_found_position = relative_path.find(perf_regex_template) - 1;
-  relative_path.erase(last_found_position, relative_path.length() - 1);
+void ppc::core::Perf::ReportPerfStatistic(const std::shared_ptr<PerfResults>& perf_results) {
+  PrintDetails(RecordPerfStatistic(perf_results), perf_results);
+}
 
-  std::stringstream perf_res_str;
+void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results) {
+  const auto relative_path = RecordPerfStatistic(perf_results);
+  const auto time_secs = perf_results->time_sec;
   if (time_secs < PerfResults::kMaxTime) {
-    perf_res_str << std::fixed << std::setprecision(10) << time_secs;
-    std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
+    PrintDetails(relative_path, perf_results);
+    if (perf_results->baseline.regression) {
+      std::stringstream err_msg;
+      const auto& baseline = perf_results->baseline;
+      err_msg << '\n' << "Task is slower than the baseline: median " << baseline.current_median << " secs vs "
+              << baseline.baseline_median << " secs (p = " << baseline.p_value << ")." << '\n';
+      throw std::runtime_error(err_msg.str().c_str());
+    }
   } else {
     std::stringstream err_msg;
     err_msg << '\n' << "Task execute time need to be: ";
     err_msg << "time < " << PerfResults::kMaxTime << " secs." << '\n';
     err_msg << "Original time in secs: " << time_secs << '\n';
+    std::stringstream perf_res_str;
     perf_res_str << std::fixed << std::setprecision(10) << -1.0;
-    std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
+    std::cout << relative_path << ":" << PerfReport::GetModeName(perf_results->type_of_running) << ":"
+              << perf_res_str.str() << '\n';
     throw std::runtime_error(err_msg.str().c_str());
   }
 }
@@ -0,0 +1,194 @@
+#include "core/perf/include/report.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "core/perf/include/hw_counters.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/timer.hpp"
+#include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+std::string EscapeJson(const std::string &str) {
+  std::string res;
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      res += '\\';
+    }
+    res += c;
+  }
+  return res;
+}
+
+std::string EscapeCsv(const std::string &str) {
+  if (str.find_first_of(",\"\n") == std::string::npos) {
+    return str;
+  }
+  std::string res = "\"";
+  for (char c : str) {
+    if (c == '"') {
+      res += '"';
+    }
+    res += c;
+  }
+  return res + "\"";
+}
+
+}  // namespace
+
+std::string ppc::core::PerfReport::GetReportPath() { return ppc::util::GetEnv("PPC_PERF_REPORT"); }
+
+const char *ppc::core::PerfReport::GetModeName(PerfResults::TypeOfRunning type_of_running) {
+  switch (type_of_running) {
+    case PerfResults::kPipeline:
+      return "pipeline";
+    case PerfResults::kTaskRun:
+      return "task_run";
+    case PerfResults::kNone:
+      return "none";
+  }
+  return "none";
+}
+
+std::string ppc::core::PerfReport::ToJson(const PerfResults &perf_results) {
+  std::stringstream json;
+  json << std::setprecision(10);
+  json << R"({"backend": ")" << EscapeJson(perf_results.backend) << R"(", "task": ")"
+       << EscapeJson(perf_results.task_name) << R"(", "mode": ")" << GetModeName(perf_results.type_of_running)
+       << R"(", "num_processes": )" << perf_results.num_processes << R"(, "num_threads": )"
+       << perf_results.num_threads << R"(, "input_size": )" << perf_results.input_size << R"(, "num_samples": )"
+       << perf_results.samples.size() << R"(, "time_sec": )" << perf_results.time_sec << R"(, "timer": ")"
+       << PerfTimer::GetName(perf_results.timer) << R"(", "timer_overhead": )" << perf_results.timer_overhead << ", ";
+  const auto &stats = perf_results.stats;
+  json << R"("min": )" << stats.min << R"(, "median": )" << stats.median << R"(, "mean": )" << stats.mean
+       << R"(, "p90": )" << stats.p90 << R"(, "p99": )" << stats.p99 << R"(, "max": )" << stats.max
+       << R"(, "stddev": )" << stats.stddev;
+  json << R"(, "samples": [)";
+  for (size_t i = 0; i < perf_results.samples.size(); i++) {
+    json << (i == 0 ? "" : ", ") << perf_results.samples[i];
+  }
+  json << "]";
+
+  for (size_t phase = 0; phase < Task::kNumPhases; phase++) {
+    if (perf_results.phase_samples[phase].empty()) {
+      continue;
+    }
+    const auto &phase_stats = perf_results.phase_stats[phase];
+    json << R"(, "phase_)" << Task::GetPhaseName(static_cast<Task::Phase>(phase)) << R"(": {"calls": )"
+         << perf_results.phase_samples[phase].size() << R"(, "median": )" << phase_stats.median << R"(, "mean": )"
+         << phase_stats.mean << R"(, "max": )" << phase_stats.max << "}";
+  }
+
+  for (size_t phase = 0; phase < Task::kNumPhases; phase++) {
+    const auto &memory = perf_results.phase_memory[phase];
+    if (memory.calls == 0) {
+      continue;
+    }
+    json << R"(, "memory_)" << Task::GetPhaseName(static_cast<Task::Phase>(phase)) << R"(": {"calls": )"
+         << memory.calls << R"(, "allocations": )" << memory.allocations << R"(, "allocated_bytes": )"
+         << memory.allocated_bytes << R"(, "peak_heap_bytes": )" << memory.peak_heap_bytes
+         << R"(, "peak_rss_bytes": )" << memory.peak_rss_bytes << "}";
+  }
+
+  const auto &ranks = perf_results.ranks;
+  if (!ranks.per_rank.empty()) {
+    json << R"(, "ranks": {"min": )" << ranks.min << R"(, "mean": )" << ranks.mean << R"(, "max": )" << ranks.max
+         << R"(, "imbalance": )" << ranks.imbalance << R"(, "per_rank": [)";
+    for (size_t i = 0; i < ranks.per_rank.size(); i++) {
+      json << (i == 0 ? "" : ", ") << ranks.per_rank[i];
+    }
+    json << "]}";
+  }
+
+  const auto &baseline = perf_results.baseline;
+  if (baseline.available) {
+    json << R"(, "baseline": {"median": )" << baseline.baseline_median << R"(, "change": )" << baseline.change
+         << R"(, "p_value": )" << baseline.p_value << R"(, "regression": )" << (baseline.regression ? "true" : "false")
+         << "}";
+  }
+
+  const auto &counters = perf_results.hw_counters;
+  for (size_t i = 0; i < HwCounterValues::kNumCounters; i++) {
+    if (counters.available[i]) {
+      json << R"(, ")" << HwCounterValues::GetCounterName(static_cast<HwCounterValues::Counter>(i))
+           << R"(": )" << counters.values[i];
+    }
+  }
+  json << "}";
+  return json.str();
+}
+
+std::string ppc::core::PerfReport::GetCsvHeader() {
+  std::stringstream csv;
+  csv << "backend,task,mode,num_processes,num_threads,input_size,num_samples,time_sec,min,median,mean,p90,p99,max,"
+         "stddev";
+  for (size_t phase = 0; phase < Task::kNumPhases; phase++) {
+    csv << ",phase_" << Task::GetPhaseName(static_cast<Task::Phase>(phase)) << "_mean";
+  }
+  for (size_t i = 0; i < HwCounterValues::kNumCounters; i++) {
+    csv << "," << HwCounterValues::GetCounterName(static_cast<HwCounterValues::Counter>(i));
+  }
+  csv << ",rank_min,rank_mean,rank_max,imbalance,baseline_change,baseline_p_value";
+  return csv.str();
+}
+
+std::string ppc::core::PerfReport::ToCsv(const PerfResults &perf_results) {
+  const auto &stats = perf_results.stats;
+  std::stringstream csv;
+  csv << std::setprecision(10);
+  csv << EscapeCsv(perf_results.backend) << "," << EscapeCsv(perf_results.task_name) << ","
+      << GetModeName(perf_results.type_of_running) << "," << perf_results.num_processes << ","
+      << perf_results.num_threads << "," << perf_results.input_size << "," << perf_results.samples.size() << ","
+      << perf_results.time_sec << "," << stats.min << "," << stats.median << "," << stats.mean << "," << stats.p90
+      << "," << stats.p99 << "," << stats.max << "," << stats.stddev;
+  for (size_t phase = 0; phase < Task::kNumPhases; phase++) {
+    csv << ",";
+    if (!perf_results.phase_samples[phase].empty()) {
+      csv << perf_results.phase_stats[phase].mean;
+    }
+  }
+  for (size_t i = 0; i < HwCounterValues::kNumCounters; i++) {
+    csv << ",";
+    if (perf_results.hw_counters.available[i]) {
+      csv << perf_results.hw_counters.values[i];
+    }
+  }
+  const auto &ranks = perf_results.ranks;
+  if (ranks.per_rank.empty()) {
+    csv << ",,,,";
+  } else {
+    csv << "," << ranks.min << "," << ranks.mean << "," << ranks.max << "," << ranks.imbalance;
+  }
+  if (perf_results.baseline.available) {
+    csv << "," << perf_results.baseline.change << "," << perf_results.baseline.p_value;
+  } else {
+    csv << ",,";
+  }
+  return csv.str();
+}
+
+void ppc::core::PerfReport::Append(const std::string &path, const PerfResults &perf_results) {
+  const bool is_csv = std::filesystem::path(path).extension() == ".csv";
+  std::error_code ec;
+  const bool is_empty = !std::filesystem::exists(path, ec) || std::filesystem::file_size(path, ec) == 0;
+
+  std::ofstream report(path, std::ios_base::app);
+  if (!report.is_open()) {
+    throw std::runtime_error("Cannot open perf report file: " + path);
+  }
+  if (is_csv) {
+    if (is_empty) {
+      report << GetCsvHeader() << '\n';
+    }
+    report << ToCsv(perf_results) << '\n';
+  } else {
+    report << ToJson(perf_results) << '\n';
+  }
+}
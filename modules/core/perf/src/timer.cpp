@@ -0,0 +1,179 @@
+#include "core/perf/include/timer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+#include <time.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define PPC_HAS_TSC 1
+#endif
+
+namespace {
+
+double SteadyNow() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#ifdef __linux__
+double ClockNow(clockid_t clock) {
+  timespec time{};
+  clock_gettime(clock, &time);
+  return static_cast<double>(time.tv_sec) + (static_cast<double>(time.tv_nsec) * 1e-9);
+}
+#endif
+
+#ifdef PPC_HAS_TSC
+uint64_t ReadTsc() {
+  // keeps earlier loads from being reordered past the read
+  _mm_lfence();
+  return __rdtsc();
+}
+#endif
+
+}  // namespace
+
+bool ppc::core::PerfTimer::TscAvailable() {
+#ifdef PPC_HAS_TSC
+  // CPUID.80000007H:EDX[8] is the invariant TSC flag
+  unsigned int eax = 0;
+  unsigned int ebx = 0;
+  unsigned int ecx = 0;
+  unsigned int edx = 0;
+  return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) != 0 && (edx & (1U << 8)) != 0;
+#else
+  return false;
+#endif
+}
+
+double ppc::core::PerfTimer::TscFrequency() {
+#ifdef PPC_HAS_TSC
+  static const double kFrequency = [] {
+    // best of a few 10 ms windows, a preempted window only looks longer on one of the clocks
+    double best = 0.0;
+    double best_error = std::numeric_limits<double>::max();
+    for (int attempt = 0; attempt < 3; attempt++) {
+      const auto steady_begin = std::chrono::steady_clock::now();
+      const auto tsc_begin = ReadTsc();
+      const auto setup = std::chrono::steady_clock::now() - steady_begin;
+      std::chrono::steady_clock::time_point steady_end;
+      do {
+        steady_end = std::chrono::steady_clock::now();
+      } while (steady_end - steady_begin < std::chrono::milliseconds(10));
+      const auto tsc_end = ReadTsc();
+      const double seconds = std::chrono::duration<double>(steady_end - steady_begin).count();
+      const double error = std::chrono::duration<double>(setup).count();
+      if (error < best_error) {
+        best_error = error;
+        best = static_cast<double>(tsc_end - tsc_begin) / seconds;
+      }
+    }
+    return best;
+  }();
+  return kFrequency;
+#else
+  return 0.0;
+#endif
+}
+
+ppc::core::PerfTimer::PerfTimer(TimerKind kind, WtimeFunction mpi_wtime) : kind_(kind), mpi_wtime_(mpi_wtime) {
+  if (kind_ == TimerKind::kMpiWtime && mpi_wtime_ == nullptr) {
+    throw std::invalid_argument("TimerKind::kMpiWtime needs MPI_Wtime, see UseMpiWtime");
+  }
+  if (kind_ == TimerKind::kTsc) {
+    if (TscAvailable() && TscFrequency() > 0.0) {
+      tsc_period_ = 1.0 / TscFrequency();
+#ifdef PPC_HAS_TSC
+      tsc_origin_ = ReadTsc();
+#endif
+    } else {
+      kind_ = TimerKind::kMonotonicRaw;
+    }
+  }
+#ifndef __linux__
+  if (kind_ == TimerKind::kMonotonicRaw || kind_ == TimerKind::kThreadCpu) {
+    kind_ = TimerKind::kSteady;
+  }
+#endif
+}
+
+double ppc::core::PerfTimer::Now() const {
+  switch (kind_) {
+    case TimerKind::kSteady:
+      return SteadyNow();
+#ifdef __linux__
+    case TimerKind::kMonotonicRaw:
+      return ClockNow(CLOCK_MONOTONIC_RAW);
+    case TimerKind::kThreadCpu:
+      return ClockNow(CLOCK_THREAD_CPUTIME_ID);
+#else
+    case TimerKind::kMonotonicRaw:
+    case TimerKind::kThreadCpu:
+      return SteadyNow();
+#endif
+    case TimerKind::kTsc:
+#ifdef PPC_HAS_TSC
+      // ticks since construction are exact, only the difference is converted to seconds, so
+      // the samples do not lose precision to the absolute counter value
+      return static_cast<double>(ReadTsc() - tsc_origin_) * tsc_period_;
+#else
+      return SteadyNow();
+#endif
+    case TimerKind::kMpiWtime:
+      return mpi_wtime_();
+    case TimerKind::kCustom:
+      return 0.0;
+  }
+  return 0.0;
+}
+
+double ppc::core::PerfTimer::MeasureOverhead() const {
+  constexpr int kBatches = 16;
+  constexpr int kReadsPerBatch = 64;
+  double best = std::numeric_limits<double>::max();
+  for (int batch = 0; batch < kBatches; batch++) {
+    const double begin = Now();
+    double end = begin;
+    for (int i = 0; i < kReadsPerBatch; i++) {
+      end = Now();
+    }
+    best = std::min(best, (end - begin) / kReadsPerBatch);
+  }
+  return std::max(best, 0.0);
+}
+
+const char *ppc::core::PerfTimer::GetName(TimerKind kind) {
+  switch (kind) {
+    case TimerKind::kCustom:
+      return "custom";
+    case TimerKind::kSteady:
+      return "steady";
+    case TimerKind::kMonotonicRaw:
+      return "monotonic_raw";
+    case TimerKind::kTsc:
+      return "tsc";
+    case TimerKind::kThreadCpu:
+      return "thread_cpu";
+    case TimerKind::kMpiWtime:
+      return "mpi_wtime";
+  }
+  return "custom";
+}
+
+ppc::core::TimerKind ppc::core::PerfTimer::FromName(const std::string &name) {
+  for (auto kind : {TimerKind::kCustom, TimerKind::kSteady, TimerKind::kMonotonicRaw, TimerKind::kTsc,
+                    TimerKind::kThreadCpu, TimerKind::kMpiWtime}) {
+    if (name == GetName(kind)) {
+      return kind;
+    }
+  }
+  throw std::invalid_argument("Unknown timer " + name);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "core/pool/include/thread_pool.hpp"
+
+TEST(thread_pool_tests, check_parallel_for_covers_range) {
+  ppc::core::ThreadPool pool(4);
+  std::vector<int> hits(1000, 0);
+  pool.ParallelFor(0, hits.size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      hits[i]++;
+    }
+  });
+  for (int hit : hits) {
+    EXPECT_EQ(hit, 1);
+  }
+
+  bool called = false;
+  pool.ParallelFor(5, 5, [&](size_t, size_t) { called = true; });
+  EXPECT_FALSE(called);
+}
+
+TEST(thread_pool_tests, check_work_runs_on_several_threads) {
+  ppc::core::ThreadPool pool(4);
+  std::mutex mutex;
+  std::set<std::thread::id> ids;
+  pool.ParallelFor(
+      0, 64,
+      [&](size_t, size_t) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        std::lock_guard lock(mutex);
+        ids.insert(std::this_thread::get_id());
+      },
+      1);
+  EXPECT_GT(ids.size(), 1U);
+  EXPECT_LE(ids.size(), 4U);
+}
+
+TEST(thread_pool_tests, check_parallel_reduce) {
+  ppc::core::ThreadPool pool(3);
+  std::vector<int64_t> values(10007);
+  std::iota(values.begin(), values.end(), 1);
+  auto sum = pool.ParallelReduce(
+      0, values.size(), int64_t{0},
+      [&](size_t begin, size_t end) {
+        int64_t local = 0;
+        for (size_t i = begin; i < end; i++) {
+          local += values[i];
+        }
+        return local;
+      },
+      [](int64_t a, int64_t b) { return a + b; }, 100);
+  EXPECT_EQ(sum, int64_t{10007} * 10008 / 2);
+
+  // chunks are combined left to right
+  auto order = pool.ParallelReduce(
+      0, 4, std::vector<size_t>{}, [](size_t begin, size_t) { return std::vector<size_t>{begin}; },
+      [](std::vector<size_t> a, const std::vector<size_t> &b) {
+        a.insert(a.end(), b.begin(), b.end());
+        return a;
+      },
+      1);
+  EXPECT_EQ(order, std::vector<size_t>({0, 1, 2, 3}));
+}
+
+TEST(thread_pool_tests, check_nested_and_exceptions) {
+  ppc::core::ThreadPool pool(2);
+  std::atomic<int> total = 0;
+  pool.ParallelFor(
+      0, 8,
+      [&](size_t, size_t) {
+        pool.ParallelFor(0, 8, [&](size_t begin, size_t end) { total += static_cast<int>(end - begin); }, 1);
+      },
+      1);
+  EXPECT_EQ(total.load(), 64);
+
+  EXPECT_THROW(pool.ParallelFor(
+                   0, 16,
+                   [](size_t begin, size_t) {
+                     if (begin == 7) {
+                       throw std::runtime_error("chunk failed");
+                     }
+                   },
+                   1),
+               std::runtime_error);
+}
+
+TEST(thread_pool_tests, check_single_thread_runs_inline) {
+  ppc::core::ThreadPool pool(1);
+  EXPECT_EQ(pool.Size(), 1U);
+  auto caller = std::this_thread::get_id();
+  pool.ParallelFor(0, 100, [&](size_t, size_t) { EXPECT_EQ(std::this_thread::get_id(), caller); }, 1);
+  EXPECT_GE(ppc::core::ThreadPool::Shared().Size(), 1U);
+}
+
+TEST(thread_pool_tests, check_concurrent_callers) {
+  ppc::core::ThreadPool pool(3);
+  std::vector<std::thread> callers;
+  std::vector<uint64_t> sums(4, 0);
+  for (size_t c = 0; c < sums.size(); c++) {
+    callers.emplace_back([&pool, &sums, c] {
+      for (int round = 0; round < 200; round++) {
+        std::atomic<uint64_t> sum = 0;
+        pool.ParallelFor(
+            0, 64,
+            [&](size_t begin, size_t end) {
+              for (size_t i = begin; i < end; i++) {
+                sum += i;
+              }
+            },
+            4);
+        sums[c] += sum;
+      }
+    });
+  }
+  for (auto &caller : callers) {
+    caller.join();
+  }
+  for (uint64_t sum : sums) {
+    EXPECT_EQ(sum, 200U * (63U * 64U / 2));
+  }
+}
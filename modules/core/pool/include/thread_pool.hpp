@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ppc::core {
+
+// Persistent workers with one deque each: a worker pops its own jobs from the back and
+// steals from the front of the others when it runs dry. The thread that calls
+// ParallelFor/ParallelReduce takes part in the work, so a pool of size n starts n - 1
+// threads and nested calls from inside a job do not deadlock.
+class ThreadPool {
+ public:
+  explicit ThreadPool(size_t num_threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  // pool shared by the STL tasks, sized from ppc::util::GetPPCNumThreads() on first use
+  static ThreadPool &Shared();
+
+  [[nodiscard]] size_t Size() const { return queues_.size(); }
+
+  // body(chunk_begin, chunk_end) over [begin, end) split into chunks of about grain
+  // elements (0 - a few chunks per thread), rethrows the first exception of the body
+  void ParallelFor(size_t begin, size_t end, const std::function<void(size_t, size_t)> &body, size_t grain = 0);
+
+  // map(chunk_begin, chunk_end) -> T for every chunk, the results are combined left to
+  // right starting from identity, so the result does not depend on the scheduling
+  template <typename T, typename MapFn, typename CombineFn>
+  T ParallelReduce(size_t begin, size_t end, T identity, MapFn map, CombineFn combine, size_t grain = 0) {
+    const size_t chunk = ChunkSize(begin, end, grain);
+    const size_t num_chunks = end > begin ? (end - begin + chunk - 1) / chunk : 0;
+    std::vector<T> partial(num_chunks, identity);
+    ParallelFor(
+        0, num_chunks,
+        [&](size_t first, size_t last) {
+          for (size_t c = first; c < last; c++) {
+            size_t chunk_begin = begin + (c * chunk);
+            partial[c] = map(chunk_begin, std::min(chunk_begin + chunk, end));
+          }
+        },
+        1);
+    T res = identity;
+    for (auto &value : partial) {
+      res = combine(res, value);
+    }
+    return res;
+  }
+
+ private:
+  using Job = std::function<void()>;
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+
+  [[nodiscard]] size_t ChunkSize(size_t begin, size_t end, size_t grain) const;
+  // index of the queue of the current thread, external threads share the last one
+  [[nodiscard]] size_t QueueIndex() const;
+  void Push(Job job);
+  // notifies sleeping workers and ParallelFor callers waiting for their chunks
+  void WakeUp(bool all);
+  bool TryRunOne(size_t index);
+  void WorkerLoop(size_t index);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+  // jobs in the queues, changed under the lock of the queue
+  std::atomic<size_t> queued_ = 0;
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  bool stop_ = false;
+};
+
+}  // namespace ppc::core
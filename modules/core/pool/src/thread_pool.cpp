@@ -0,0 +1,168 @@
+#include "core/pool/include/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "core/util/include/util.hpp"
+
+namespace {
+thread_local const ppc::core::ThreadPool *current_pool = nullptr;
+thread_local size_t current_index = 0;
+}  // namespace
+
+ppc::core::ThreadPool::ThreadPool(size_t num_threads) {
+  num_threads = std::max<size_t>(num_threads, 1);
+  for (size_t i = 0; i < num_threads; i++) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  workers_.reserve(num_threads - 1);
+  for (size_t i = 0; i + 1 < num_threads; i++) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+  }
+}
+
+ppc::core::ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock(sleep_mutex_);
+    stop_ = true;
+  }
+  sleep_cv_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+ppc::core::ThreadPool &ppc::core::ThreadPool::Shared() {
+  static ThreadPool pool(static_cast<size_t>(std::max(ppc::util::GetPPCNumThreads(), 1)));
+  return pool;
+}
+
+size_t ppc::core::ThreadPool::ChunkSize(size_t begin, size_t end, size_t grain) const {
+  if (grain > 0) {
+    return grain;
+  }
+  return std::max<size_t>((end > begin ? end - begin : 0) / (Size() * 4), 1);
+}
+
+size_t ppc::core::ThreadPool::QueueIndex() const { return current_pool == this ? current_index : Size() - 1; }
+
+void ppc::core::ThreadPool::Push(Job job) {
+  auto &queue = *queues_[QueueIndex()];
+  {
+    // counted under the queue lock, so the job can not be taken (and uncounted) before that
+    std::lock_guard lock(queue.mutex);
+    queue.jobs.push_back(std::move(job));
+    queued_++;
+  }
+  WakeUp(false);
+}
+
+bool ppc::core::ThreadPool::TryRunOne(size_t index) {
+  Job job;
+  for (size_t i = 0; i < Size() && !job; i++) {
+    auto &queue = *queues_[(index + i) % Size()];
+    std::lock_guard lock(queue.mutex);
+    if (queue.jobs.empty()) {
+      continue;
+    }
+    // own jobs are taken LIFO for locality, stolen ones FIFO to take the biggest pieces
+    if (i == 0) {
+      job = std::move(queue.jobs.back());
+      queue.jobs.pop_back();
+    } else {
+      job = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+    }
+    queued_--;
+  }
+  if (!job) {
+    return false;
+  }
+  job();
+  return true;
+}
+
+void ppc::core::ThreadPool::WakeUp(bool all) {
+  // a thread between checking its wait condition and blocking holds sleep_mutex_, taking it
+  // here makes sure the notification does not fall into that gap
+  { const std::lock_guard lock(sleep_mutex_); }
+  if (all) {
+    sleep_cv_.notify_all();
+  } else {
+    sleep_cv_.notify_one();
+  }
+}
+
+void ppc::core::ThreadPool::WorkerLoop(size_t index) {
+  current_pool = this;
+  current_index = index;
+  // worker i takes cpu i of the PPC_AFFINITY plan, the calling thread is left as is
+  ppc::util::PinCurrentThread(static_cast<int>(index), static_cast<int>(Size()));
+  while (true) {
+    if (TryRunOne(index)) {
+      continue;
+    }
+    std::unique_lock lock(sleep_mutex_);
+    sleep_cv_.wait(lock, [this] { return stop_ || queued_ > 0; });
+    if (stop_ && queued_ == 0) {
+      return;
+    }
+  }
+}
+
+void ppc::core::ThreadPool::ParallelFor(size_t begin, size_t end, const std::function<void(size_t, size_t)> &body,
+                                        size_t grain) {
+  if (end <= begin) {
+    return;
+  }
+  const size_t chunk = ChunkSize(begin, end, grain);
+  if (Size() == 1 || end - begin <= chunk) {
+    body(begin, end);
+    return;
+  }
+
+  std::atomic<size_t> pending = 0;
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  auto run = [&](size_t first, size_t last) {
+    try {
+      body(first, last);
+    } catch (...) {
+      std::lock_guard lock(error_mutex);
+      error = error ? error : std::current_exception();
+    }
+  };
+
+  for (size_t first = begin + chunk; first < end; first += chunk) {
+    pending++;
+    Push([this, &run, &pending, first, last = std::min(first + chunk, end)] {
+      run(first, last);
+      if (--pending == 0) {
+        WakeUp(true);
+      }
+    });
+  }
+  run(begin, begin + chunk);
+
+  // help with the remaining chunks (or anything else queued), sleep while all of them are
+  // taken by other threads
+  const size_t index = QueueIndex();
+  while (pending > 0) {
+    if (TryRunOne(index)) {
+      continue;
+    }
+    std::unique_lock lock(sleep_mutex_);
+    sleep_cv_.wait(lock, [&] { return pending == 0 || queued_ > 0; });
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
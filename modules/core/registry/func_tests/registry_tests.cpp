@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/perf/func_tests/test_task.hpp"
+#include "core/registry/include/registry.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+// sum of size ones, registered once for the whole test binary
+ppc::core::TaskInfo MakeSumInfo(const std::string &backend, bool correct) {
+  return {
+      .name = "registry_sum",
+      .backend = backend,
+      .description = "sum of ones",
+      .default_size = 100,
+      .input_on_root_only = false,
+      .create = [](ppc::core::TaskDataPtr task_data) -> std::shared_ptr<ppc::core::Task> {
+        return std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+      },
+      .generate =
+          [](ppc::core::BenchmarkCase &bench_case, size_t size) {
+            std::ranges::fill(bench_case.arena.AddInput<uint32_t>(*bench_case.task_data, size), 1U);
+            bench_case.arena.AddOutput<uint32_t>(*bench_case.task_data, 1)[0] = 0;
+          },
+      .verify =
+          [correct](const ppc::core::BenchmarkCase &bench_case, size_t size) {
+            return correct == (bench_case.task_data->OutputView<uint32_t>(0)[0] == size);
+          },
+  };
+}
+
+const ppc::core::TaskRegistrar kSeqRegistrar(MakeSumInfo("seq", true));
+const ppc::core::TaskRegistrar kBrokenRegistrar(MakeSumInfo("broken", false));
+
+int RunCli(const std::vector<std::string> &args, const ppc::core::BenchmarkOptions &options = {}) {
+  std::vector<std::string> full_args = {"benchmark"};
+  full_args.insert(full_args.end(), args.begin(), args.end());
+  std::vector<char *> argv;
+  for (auto &arg : full_args) {
+    argv.push_back(arg.data());
+  }
+  return ppc::core::RunBenchmarkCli(static_cast<int>(argv.size()), argv.data(), options);
+}
+
+}  // namespace
+
+TEST(registry_tests, check_find_and_list) {
+  auto &registry = ppc::core::TaskRegistry::Instance();
+  ASSERT_NE(registry.Find("registry_sum", "seq"), nullptr);
+  EXPECT_EQ(registry.Find("registry_sum", "seq")->default_size, 100U);
+  EXPECT_EQ(registry.Find("registry_sum", "omp"), nullptr);
+  EXPECT_EQ(registry.Find("unknown"), nullptr);
+  // registered for two backends
+  EXPECT_THROW(static_cast<void>(registry.Find("registry_sum")), std::invalid_argument);
+
+  auto list = registry.List();
+  ASSERT_GE(list.size(), 2U);
+  EXPECT_TRUE(std::ranges::is_sorted(list, {}, [](const ppc::core::TaskInfo *info) { return info->backend; }));
+
+  EXPECT_THROW(registry.Add(MakeSumInfo("seq", true)), std::invalid_argument);
+  auto incomplete = MakeSumInfo("omp", true);
+  incomplete.generate = nullptr;
+  EXPECT_THROW(registry.Add(incomplete), std::invalid_argument);
+}
+
+TEST(registry_tests, check_cli) {
+  EXPECT_EQ(RunCli({"--list"}), 0);
+  EXPECT_EQ(RunCli({"--task", "registry_sum", "--backend", "seq", "--size", "10,1000", "--runs", "3", "--verify"}), 0);
+  EXPECT_EQ(RunCli({"--task", "registry_sum", "--backend", "seq", "--mode", "task_run", "--phases"}), 0);
+  EXPECT_EQ(RunCli({"--task", "registry_sum", "--backend", "seq", "--timer", "thread_cpu"}), 0);
+  EXPECT_EQ(RunCli({"--task", "registry_sum", "--backend", "broken", "--runs", "1", "--verify"}), 2);
+
+  EXPECT_EQ(RunCli({}), 1);
+  EXPECT_EQ(RunCli({"--task", "unknown"}), 1);
+  EXPECT_EQ(RunCli({"--task", "registry_sum"}), 1);
+  EXPECT_EQ(RunCli({"--task", "registry_sum", "--backend", "seq", "--mode", "fast"}), 1);
+  EXPECT_EQ(RunCli({"--task", "registry_sum", "--backend", "seq", "--runs"}), 1);
+  EXPECT_EQ(RunCli({"--task", "registry_sum", "--backend", "seq", "--timer", "custom"}), 1);
+  // MPI_Wtime is only known to the MPI benchmark
+  EXPECT_EQ(RunCli({"--task", "registry_sum", "--backend", "seq", "--timer", "mpi_wtime"}), 1);
+}
+
+TEST(registry_tests, check_cli_stops_all_ranks_after_failed_size) {
+  std::vector<bool> statuses;
+  ppc::core::BenchmarkOptions options;
+  options.all_passed = [&](bool ok) {
+    statuses.push_back(ok);
+    return ok;
+  };
+  EXPECT_EQ(RunCli({"--task", "registry_sum", "--backend", "seq", "--size", "10,20", "--runs", "1"}, options), 0);
+  EXPECT_EQ(statuses, std::vector<bool>({true, true}));
+
+  // the first size fails, the second one is not started
+  statuses.clear();
+  EXPECT_EQ(RunCli({"--task", "registry_sum", "--backend", "broken", "--size", "10,20", "--runs", "1", "--verify"},
+                   options),
+            2);
+  EXPECT_EQ(statuses, std::vector<bool>({false}));
+
+  // another rank failed: this one stops as well
+  options.all_passed = [](bool) { return false; };
+  EXPECT_EQ(RunCli({"--task", "registry_sum", "--backend", "seq", "--size", "10,20", "--runs", "1"}, options), 2);
+}
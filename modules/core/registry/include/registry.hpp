@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/mem/include/arena.hpp"
+#include "core/perf/include/timer.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Input of one benchmark run: the generator fills buffers of the arena and registers
+// them in task_data (BufferArena::AddInput/AddOutput), the case owns all of them
+struct BenchmarkCase {
+  BufferArena arena;
+  TaskDataPtr task_data = std::make_shared<TaskData>();
+};
+
+struct TaskInfo {
+  std::string name;
+  // seq, mpi, omp, stl, tbb
+  std::string backend;
+  std::string description;
+  // meaning of the size is task specific (elements, matrix side, ...)
+  size_t default_size = 0;
+  // MPI tasks that read task_data on rank 0 only get an empty TaskData on other ranks
+  bool input_on_root_only = false;
+  std::function<std::shared_ptr<Task>(TaskDataPtr)> create;
+  std::function<void(BenchmarkCase &, size_t)> generate;
+  // optional check of the outputs after the run
+  std::function<bool(const BenchmarkCase &, size_t)> verify;
+};
+
+// Tasks that can be run by the benchmark executables. Registration happens from static
+// objects of the bench/ sources of every task, which are linked into the executable
+// directly (objects of static libraries without references would be dropped).
+class TaskRegistry {
+ public:
+  static TaskRegistry &Instance();
+
+  // throws std::invalid_argument on an incomplete entry or a duplicate name/backend pair
+  void Add(TaskInfo info);
+  // sorted by backend and name
+  [[nodiscard]] std::vector<const TaskInfo *> List() const;
+  // backend may be empty if the name is unique
+  [[nodiscard]] const TaskInfo *Find(const std::string &name, const std::string &backend = {}) const;
+
+ private:
+  std::vector<TaskInfo> tasks_;
+};
+
+struct TaskRegistrar {
+  explicit TaskRegistrar(TaskInfo info) { TaskRegistry::Instance().Add(std::move(info)); }
+};
+
+struct BenchmarkOptions {
+  // see PerfAttr::rank_gather
+  std::function<std::vector<double>(const std::vector<double> &)> rank_gather;
+  // see PerfAttr::mpi_wtime, needed by --timer mpi_wtime
+  PerfTimer::WtimeFunction mpi_wtime = nullptr;
+  // only the root rank generates root-only inputs and prints
+  bool is_root = true;
+  // true on every rank if the size passed on all of them (an all-reduce in the MPI benchmark),
+  // stops all ranks together after a failed size; nullptr for a single process
+  std::function<bool(bool)> all_passed;
+};
+
+// Command line front end shared by the <backend>_benchmark executables:
+//   --list                          registered tasks
+//   --task NAME [--backend B]       task to run
+//   --size N[,N...]                 input sizes (default size of the task otherwise)
+//   --runs N --warmup N             timed and untimed iterations (10 and 1)
+//   --mode pipeline|task_run        measured part of the lifecycle (pipeline)
+//   --timer NAME                    clock of timed iterations, see PerfTimer::GetName (steady)
+//   --phases --hw-counters --memory --verify
+// Results go through Perf::ReportPerfStatistic, so PPC_PERF_REPORT and PPC_PERF_BASELINE
+// apply but PerfResults::kMaxTime does not. A wrong result, a baseline regression or an
+// exception stops the sweep. Returns the process exit code.
+int RunBenchmarkCli(int argc, char **argv, const BenchmarkOptions &options = {});
+
+}  // namespace ppc::core
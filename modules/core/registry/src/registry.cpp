@@ -0,0 +1,247 @@
+#include "core/registry/include/registry.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/timer.hpp"
+#include "core/task/include/task.hpp"
+
+ppc::core::TaskRegistry &ppc::core::TaskRegistry::Instance() {
+  static TaskRegistry registry;
+  return registry;
+}
+
+void ppc::core::TaskRegistry::Add(TaskInfo info) {
+  if (info.name.empty() || info.backend.empty() || !info.create || !info.generate) {
+    throw std::invalid_argument("TaskRegistry entry needs a name, a backend, a factory and a generator");
+  }
+  if (std::ranges::any_of(tasks_, [&](const TaskInfo &task) {
+        return task.name == info.name && task.backend == info.backend;
+      })) {
+    throw std::invalid_argument("TaskRegistry already has " + info.backend + "/" + info.name);
+  }
+  tasks_.push_back(std::move(info));
+}
+
+std::vector<const ppc::core::TaskInfo *> ppc::core::TaskRegistry::List() const {
+  std::vector<const TaskInfo *> list;
+  for (const auto &task : tasks_) {
+    list.push_back(&task);
+  }
+  std::ranges::sort(list, [](const TaskInfo *a, const TaskInfo *b) {
+    return std::tie(a->backend, a->name) < std::tie(b->backend, b->name);
+  });
+  return list;
+}
+
+const ppc::core::TaskInfo *ppc::core::TaskRegistry::Find(const std::string &name, const std::string &backend) const {
+  const TaskInfo *found = nullptr;
+  for (const auto &task : tasks_) {
+    if (task.name != name || (!backend.empty() && task.backend != backend)) {
+      continue;
+    }
+    if (found != nullptr) {
+      throw std::invalid_argument("Task " + name + " is registered for several backends, pass --backend");
+    }
+    found = &task;
+  }
+  return found;
+}
+
+namespace {
+
+struct CliArgs {
+  bool list = false;
+  std::string task;
+  std::string backend;
+  std::vector<size_t> sizes;
+  uint64_t runs = 10;
+  uint64_t warmup = 1;
+  bool task_run = false;
+  ppc::core::TimerKind timer = ppc::core::TimerKind::kSteady;
+  bool phases = false;
+  bool hw_counters = false;
+  bool memory = false;
+  bool verify = false;
+};
+
+std::vector<size_t> ParseSizes(const std::string &value) {
+  std::vector<size_t> sizes;
+  std::stringstream stream(value);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    sizes.push_back(std::stoull(item));
+  }
+  return sizes;
+}
+
+CliArgs ParseArgs(int argc, char **argv) {
+  CliArgs args;
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    auto value = [&]() -> std::string {
+      if (i + 1 >= argc) {
+        throw std::invalid_argument("Missing value of " + arg);
+      }
+      return argv[++i];
+    };
+    if (arg == "--list") {
+      args.list = true;
+    } else if (arg == "--task") {
+      args.task = value();
+    } else if (arg == "--backend") {
+      args.backend = value();
+    } else if (arg == "--size") {
+      args.sizes = ParseSizes(value());
+    } else if (arg == "--runs") {
+      args.runs = std::stoull(value());
+    } else if (arg == "--warmup") {
+      args.warmup = std::stoull(value());
+    } else if (arg == "--mode") {
+      const auto mode = value();
+      if (mode != "pipeline" && mode != "task_run") {
+        throw std::invalid_argument("Unknown mode " + mode);
+      }
+      args.task_run = mode == "task_run";
+    } else if (arg == "--timer") {
+      args.timer = ppc::core::PerfTimer::FromName(value());
+      if (args.timer == ppc::core::TimerKind::kCustom) {
+        throw std::invalid_argument("Timer custom can not be selected from the command line");
+      }
+    } else if (arg == "--phases") {
+      args.phases = true;
+    } else if (arg == "--hw-counters") {
+      args.hw_counters = true;
+    } else if (arg == "--memory") {
+      args.memory = true;
+    } else if (arg == "--verify") {
+      args.verify = true;
+    } else {
+      throw std::invalid_argument("Unknown argument " + arg);
+    }
+  }
+  return args;
+}
+
+void PrintUsage(const char *program) {
+  std::cout << "Usage: " << program << " --list\n"
+            << "       " << program
+            << " --task NAME [--backend B] [--size N[,N...]] [--runs N] [--warmup N]"
+               " [--mode pipeline|task_run] [--timer NAME] [--phases] [--hw-counters] [--memory] [--verify]\n";
+}
+
+void PrintList() {
+  for (const auto *task : ppc::core::TaskRegistry::Instance().List()) {
+    std::cout << task->backend << "\t" << task->name << "\tdefault size " << task->default_size;
+    if (!task->description.empty()) {
+      std::cout << "\t" << task->description;
+    }
+    std::cout << '\n';
+  }
+}
+
+// false if the outputs are wrong
+bool RunCase(const ppc::core::TaskInfo &info, size_t size, const CliArgs &args,
+             const ppc::core::BenchmarkOptions &options) {
+  ppc::core::BenchmarkCase bench_case;
+  const bool has_input = options.is_root || !info.input_on_root_only;
+  if (has_input) {
+    info.generate(bench_case, size);
+  }
+  auto task = info.create(bench_case.task_data);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = args.runs;
+  perf_attr->num_warmup = args.warmup;
+  perf_attr->profile_phases = args.phases;
+  perf_attr->use_hw_counters = args.hw_counters;
+  perf_attr->profile_memory = args.memory;
+  perf_attr->rank_gather = options.rank_gather;
+  perf_attr->timer = args.timer;
+  perf_attr->mpi_wtime = options.mpi_wtime;
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_results->task_name = info.name;
+  perf_results->backend = info.backend;
+
+  ppc::core::Perf perf(task);
+  if (args.task_run) {
+    perf.TaskRun(perf_attr, perf_results);
+  } else {
+    perf.PipelineRun(perf_attr, perf_results);
+  }
+  if (options.is_root) {
+    std::cout << "size " << size << '\n';
+    ppc::core::Perf::ReportPerfStatistic(perf_results);
+    if (perf_results->baseline.regression) {
+      std::cerr << info.backend << "/" << info.name << ": slower than the baseline for size " << size << '\n';
+      return false;
+    }
+  }
+
+  if (args.verify && has_input && info.verify && !info.verify(bench_case, size)) {
+    std::cerr << info.backend << "/" << info.name << ": wrong result for size " << size << '\n';
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int ppc::core::RunBenchmarkCli(int argc, char **argv, const BenchmarkOptions &options) {
+  try {
+    const auto args = ParseArgs(argc, argv);
+    if (args.list) {
+      if (options.is_root) {
+        PrintList();
+      }
+      return 0;
+    }
+    if (args.task.empty()) {
+      if (options.is_root) {
+        PrintUsage(argv[0]);
+      }
+      return 1;
+    }
+    const auto *info = TaskRegistry::Instance().Find(args.task, args.backend);
+    if (info == nullptr) {
+      std::cerr << "Unknown task " << args.task << ", see --list\n";
+      return 1;
+    }
+    if (args.timer == TimerKind::kMpiWtime && options.mpi_wtime == nullptr) {
+      throw std::invalid_argument("Timer mpi_wtime is only available in the MPI benchmark");
+    }
+    auto sizes = args.sizes.empty() ? std::vector<size_t>{info->default_size} : args.sizes;
+    for (auto size : sizes) {
+      bool ok = false;
+      try {
+        ok = RunCase(*info, size, args, options);
+      } catch (const std::exception &e) {
+        std::cerr << e.what() << '\n';
+      }
+      // only the root prints and checks the baseline, a rank that stopped alone would leave the
+      // others in the collectives of the next size
+      if (options.all_passed) {
+        ok = options.all_passed(ok);
+      }
+      if (!ok) {
+        return 2;
+      }
+    }
+    return 0;
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << '\n';
+    return 1;
+  }
+}
@@ -1,8 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "core/task/func_tests/test_task.hpp"
@@ -172,12 +178,330 @@ TEST(task_tests, check_wrong_order) {
 
   // Create Task
   ppc::test::task::TestTask<float> test_task(task_data);
+#ifdef PPC_DISABLE_ORDER_CHECKS
+  GTEST_SKIP() << "Order checks are compiled out";
+#endif
   bool is_valid = test_task.Validation();
   ASSERT_EQ(is_valid, true);
   test_task.PreProcessing();
   ASSERT_ANY_THROW(test_task.PostProcessing());
 }
 
+TEST(task_tests, check_order_over_many_cycles) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // perf mode: no time limit output on every cycle
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  task_data->state_of_testing = ppc::core::TaskData::StateOfTesting::kPerf;
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_TRUE(test_task.Validation());
+    ASSERT_TRUE(test_task.PreProcessing());
+    ASSERT_TRUE(test_task.Run());
+    ASSERT_TRUE(test_task.Run());
+    ASSERT_TRUE(test_task.PostProcessing());
+  }
+#ifdef PPC_DISABLE_ORDER_CHECKS
+  GTEST_SKIP() << "Order checks are compiled out";
+#endif
+  // repeated Run calls count once, so call 4002 is the wrong one; it stays reported until SetData
+  ASSERT_TRUE(test_task.Validation());
+  try {
+    test_task.Run();
+    FAIL() << "Run after Validation has to throw";
+  } catch (const std::invalid_argument &e) {
+    EXPECT_NE(std::string(e.what()).find("Serial number: 4002"), std::string::npos);
+    EXPECT_NE(std::string(e.what()).find("Yours function: Run"), std::string::npos);
+    EXPECT_NE(std::string(e.what()).find("Expected function: PreProcessing"), std::string::npos);
+  }
+  EXPECT_THROW(test_task.PreProcessing(), std::invalid_argument);
+
+  test_task.SetData(task_data);
+  task_data->state_of_testing = ppc::core::TaskData::StateOfTesting::kPerf;
+  EXPECT_TRUE(test_task.Validation());
+}
+
+TEST(task_tests, check_phase_profiling) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  test_task.Validation();
+  test_task.SetPhaseProfiling(true);
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  const auto &times = test_task.GetPhaseTimes();
+  EXPECT_TRUE(times[ppc::core::Task::kValidation].empty());
+  EXPECT_EQ(times[ppc::core::Task::kPreProcessing].size(), 1U);
+  EXPECT_EQ(times[ppc::core::Task::kRun].size(), 2U);
+  EXPECT_EQ(times[ppc::core::Task::kPostProcessing].size(), 1U);
+
+  test_task.ClearPhaseTimes();
+  EXPECT_TRUE(test_task.GetPhaseTimes()[ppc::core::Task::kRun].empty());
+}
+
+TEST(task_tests, check_data_views) {
+  std::vector<int32_t> in = {1, 2, 3, 4, 5, 6};
+  std::vector<double> out(2, 0.0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto flat = task_data->InputView<int32_t>(0);
+  EXPECT_EQ(flat.Data(), in.data());
+  EXPECT_EQ(flat.Size(), in.size());
+  EXPECT_TRUE(flat.IsAligned(alignof(int32_t)));
+  int32_t sum = 0;
+  for (int32_t value : flat) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 21);
+
+  auto matrix = task_data->InputView<int32_t>(0, 2, 3);
+  EXPECT_EQ(matrix(1, 0), 4);
+  EXPECT_EQ(matrix.Row(1).size(), 3U);
+  EXPECT_EQ(matrix.Row(1)[2], 6);
+  EXPECT_THROW(matrix.At(2, 0), std::out_of_range);
+
+  // every second column of the 2x3 matrix
+  ppc::core::DataView<const int32_t> column(in.data(), 3, 1, 2);
+  EXPECT_FALSE(column.IsContiguous());
+  EXPECT_EQ(column[2], 5);
+  EXPECT_THROW(static_cast<void>(column.Span()), std::logic_error);
+
+  auto out_view = task_data->OutputView<double>(0);
+  out_view[1] = 2.5;
+  EXPECT_DOUBLE_EQ(out[1], 2.5);
+
+  EXPECT_THROW(task_data->InputView<int32_t>(1), std::out_of_range);
+  EXPECT_THROW(ppc::core::DataView<const int64_t>(reinterpret_cast<const int64_t *>(in.data() + 1), 1),
+               std::invalid_argument);
+  EXPECT_THROW(task_data->MutableInputView<int32_t>(0), std::logic_error);
+  task_data->inputs_ownership = ppc::core::TaskData::kTransferred;
+  task_data->MutableInputView<int32_t>(0)[0] = 7;
+  EXPECT_EQ(in[0], 7);
+}
+
+TEST(task_tests, check_run_batch) {
+  std::vector<std::vector<int32_t>> ins = {std::vector<int32_t>(5, 1), std::vector<int32_t>(7, 2),
+                                           std::vector<int32_t>(3, 3)};
+  // the second output has a wrong size
+  std::vector<std::vector<int32_t>> outs = {std::vector<int32_t>(1, 0), std::vector<int32_t>(2, 0),
+                                            std::vector<int32_t>(1, 0)};
+
+  std::vector<ppc::core::TaskDataPtr> batch;
+  for (size_t i = 0; i < ins.size(); i++) {
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(ins[i].data()));
+    task_data->inputs_count.emplace_back(ins[i].size());
+    task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(outs[i].data()));
+    task_data->outputs_count.emplace_back(outs[i].size());
+    batch.push_back(task_data);
+  }
+
+  ppc::test::task::TestTask<int32_t> test_task(batch[0]);
+  test_task.SetPhaseProfiling(true);
+  EXPECT_EQ(test_task.RunBatch(batch), std::vector<bool>({true, false, true}));
+  EXPECT_EQ(outs[0][0], 5);
+  EXPECT_EQ(outs[1][0], 0);
+  EXPECT_EQ(outs[2][0], 9);
+  EXPECT_EQ(test_task.GetPhaseTimes()[ppc::core::Task::kValidation].size(), 3U);
+  EXPECT_EQ(test_task.GetPhaseTimes()[ppc::core::Task::kRun].size(), 2U);
+
+  // only the first item is validated, so the second one runs despite its output size
+  test_task.ClearPhaseTimes();
+  EXPECT_EQ(test_task.RunBatch(batch, true), std::vector<bool>({true, true, true}));
+  EXPECT_EQ(outs[1][0], 14);
+  EXPECT_EQ(test_task.GetPhaseTimes()[ppc::core::Task::kValidation].size(), 1U);
+
+  // a first item that fails validation stops the batch instead of skipping validation of the rest
+  const auto data_before = test_task.GetData();
+  outs[0][0] = 0;
+  EXPECT_EQ(test_task.RunBatch({batch[1], batch[0], batch[2]}, true), std::vector<bool>({false, false, false}));
+  EXPECT_EQ(outs[0][0], 0);
+  EXPECT_EQ(test_task.GetData(), data_before);
+
+  // the single-item API still works after a batch
+  test_task.SetData(batch[0]);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  EXPECT_EQ(outs[0][0], 5);
+}
+
+namespace {
+
+// throws from RunImpl on an empty input
+class ThrowOnEmptyTask : public ppc::test::task::TestTask<int32_t> {
+ public:
+  explicit ThrowOnEmptyTask(const ppc::core::TaskDataPtr &task_data) : TestTask<int32_t>(task_data) {}
+
+  bool RunImpl() override {
+    if (task_data->inputs_count[0] == 0) {
+      throw std::runtime_error("empty input");
+    }
+    return TestTask<int32_t>::RunImpl();
+  }
+};
+
+}  // namespace
+
+TEST(task_tests, check_run_batch_restores_data_on_exception) {
+  std::vector<int32_t> in(3, 1);
+  std::vector<int32_t> out(1, 0);
+  auto make_data = [&](size_t size) {
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    task_data->inputs_count.emplace_back(size);
+    task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    task_data->outputs_count.emplace_back(out.size());
+    return task_data;
+  };
+
+  auto original = make_data(in.size());
+  ThrowOnEmptyTask test_task(original);
+  EXPECT_THROW(test_task.RunBatch({make_data(2), make_data(0)}), std::runtime_error);
+  EXPECT_EQ(test_task.GetData(), original);
+}
+
+TEST(task_tests, check_run_batch_threads) {
+  constexpr size_t kBatchSize = 100;
+  std::vector<std::vector<int64_t>> ins(kBatchSize);
+  std::vector<int64_t> outs(kBatchSize, 0);
+  std::vector<ppc::core::TaskDataPtr> batch;
+  for (size_t i = 0; i < kBatchSize; i++) {
+    ins[i].assign(i + 1, 1);
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(ins[i].data()));
+    task_data->inputs_count.emplace_back(ins[i].size());
+    task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(&outs[i]));
+    task_data->outputs_count.emplace_back(1);
+    batch.push_back(task_data);
+  }
+
+  std::atomic<int> created = 0;
+  auto factory = [&created](ppc::core::TaskDataPtr task_data) {
+    created++;
+    return std::make_shared<ppc::test::task::TestTask<int64_t>>(task_data);
+  };
+  auto results = ppc::core::Task::RunBatch(factory, batch, 4, true);
+  EXPECT_LE(created.load(), 4);
+  for (size_t i = 0; i < kBatchSize; i++) {
+    EXPECT_TRUE(results[i]);
+    EXPECT_EQ(outs[i], static_cast<int64_t>(i + 1));
+  }
+
+  auto throwing_factory = [](const ppc::core::TaskDataPtr &) -> std::shared_ptr<ppc::core::Task> {
+    throw std::runtime_error("can not create task");
+  };
+  // with validate_once an invalid first item fails the whole batch
+  auto invalid = std::make_shared<ppc::core::TaskData>(*batch[0]);
+  invalid->outputs_count[0] = 2;
+  auto invalid_first = batch;
+  invalid_first[0] = invalid;
+  std::ranges::fill(outs, 0);
+  results = ppc::core::Task::RunBatch(factory, invalid_first, 1, true);
+  EXPECT_TRUE(std::ranges::none_of(results, [](bool result) { return result; }));
+  EXPECT_TRUE(std::ranges::all_of(outs, [](int64_t out) { return out == 0; }));
+
+  EXPECT_THROW(ppc::core::Task::RunBatch(throwing_factory, batch, 4), std::runtime_error);
+  EXPECT_TRUE(ppc::core::Task::RunBatch(factory, {}, 4).empty());
+}
+
+namespace {
+
+ppc::core::TaskDataPtr MakeSumData(std::vector<int32_t> &in, std::vector<int32_t> &out) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+  return task_data;
+}
+
+}  // namespace
+
+TEST(task_tests, check_run_async) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+  ppc::test::task::TestTask<int32_t> test_task(MakeSumData(in, out));
+  EXPECT_TRUE(test_task.RunAsync().get());
+  EXPECT_EQ(static_cast<size_t>(out[0]), in.size());
+  // the lifecycle can be repeated, also synchronously
+  EXPECT_TRUE(test_task.RunAsync().get());
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  std::vector<int32_t> wrong_out(2, 0);
+  ppc::test::task::TestTask<int32_t> invalid_task(MakeSumData(in, wrong_out));
+  EXPECT_FALSE(invalid_task.RunAsync().get());
+}
+
+TEST(task_tests, check_run_async_cancel) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+  ppc::test::task::FakeLongTask<int32_t> test_task(MakeSumData(in, out));
+
+  ppc::core::CancellationToken token;
+  const auto start = std::chrono::steady_clock::now();
+  auto result = test_task.RunAsync(token);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  token.Cancel();
+  EXPECT_THROW(result.get(), ppc::core::TaskCancelled);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+
+  // a cancelled token stops the run before it starts
+  EXPECT_THROW(test_task.RunAsync(token).get(), ppc::core::TaskCancelled);
+}
+
+TEST(task_tests, check_run_async_deadline) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+  ppc::test::task::FakeLongTask<int32_t> test_task(MakeSumData(in, out));
+
+  const auto start = std::chrono::steady_clock::now();
+  auto token = ppc::core::CancellationToken::WithTimeout(std::chrono::milliseconds(50));
+  EXPECT_THROW(test_task.RunAsync(token).get(), ppc::core::TaskCancelled);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+TEST(task_tests, check_time_limit_stops_polling_run) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+  ppc::test::task::FakeLongTask<int32_t> test_task(MakeSumData(in, out));
+
+  // the run gives up once the func test budget is spent instead of taking 10 seconds
+  const auto start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  EXPECT_FALSE(test_task.Run());
+  EXPECT_THROW(test_task.PostProcessing(), std::runtime_error);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(3));
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
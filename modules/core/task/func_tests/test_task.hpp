@@ -46,4 +46,22 @@ class FakeSlowTask : public TestTask<T> {
   }
 };
 
+// polls StopRequested() for up to 10 seconds instead of sleeping through its budget
+template <class T>
+class FakeLongTask : public TestTask<T> {
+ public:
+  explicit FakeLongTask(ppc::core::TaskDataPtr task_data) : TestTask<T>(task_data) {}
+
+  bool RunImpl() override {
+    const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (std::chrono::steady_clock::now() < end) {
+      if (this->StopRequested()) {
+        return false;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return TestTask<T>::RunImpl();
+  }
+};
+
 }  // namespace ppc::test::task
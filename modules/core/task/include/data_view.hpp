@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+namespace ppc::core {
+
+// Non-owning typed view of a TaskData buffer: rows x cols elements, rows are
+// row_stride elements apart. A 1D buffer is a single row.
+template <typename T>
+class DataView {
+ public:
+  DataView() = default;
+  DataView(T *data, size_t rows, size_t cols, size_t row_stride)
+      : data_(data), rows_(rows), cols_(cols), row_stride_(row_stride) {
+    if (row_stride_ < cols_ && rows_ > 1) {
+      throw std::invalid_argument("DataView row stride is less than row length");
+    }
+    if (reinterpret_cast<std::uintptr_t>(data_) % alignof(T) != 0) {
+      throw std::invalid_argument("DataView buffer is misaligned for the element type");
+    }
+  }
+  DataView(T *data, size_t size) : DataView(data, 1, size, size) {}
+
+  [[nodiscard]] T *Data() const { return data_; }
+  [[nodiscard]] size_t Rows() const { return rows_; }
+  [[nodiscard]] size_t Cols() const { return cols_; }
+  [[nodiscard]] size_t RowStride() const { return row_stride_; }
+  [[nodiscard]] size_t Size() const { return rows_ * cols_; }
+  [[nodiscard]] bool Empty() const { return Size() == 0; }
+  [[nodiscard]] bool IsContiguous() const { return rows_ <= 1 || row_stride_ == cols_; }
+  // largest power of two the buffer address is aligned to (useful to pick aligned SIMD loads)
+  [[nodiscard]] size_t Alignment() const {
+    auto address = reinterpret_cast<std::uintptr_t>(data_);
+    return address == 0 ? 0 : static_cast<size_t>(address & (~address + 1));
+  }
+  [[nodiscard]] bool IsAligned(size_t alignment) const { return Alignment() % alignment == 0; }
+
+  T &operator()(size_t row, size_t col) const { return data_[(row * row_stride_) + col]; }
+  // element by row-major index, works for strided views as well
+  T &operator[](size_t index) const { return IsContiguous() ? data_[index] : (*this)(index / cols_, index % cols_); }
+  T &At(size_t row, size_t col) const {
+    if (row >= rows_ || col >= cols_) {
+      throw std::out_of_range("DataView index is out of range");
+    }
+    return (*this)(row, col);
+  }
+
+  [[nodiscard]] std::span<T> Row(size_t row) const { return {data_ + (row * row_stride_), cols_}; }
+  // whole buffer, only for contiguous views
+  [[nodiscard]] std::span<T> Span() const {
+    if (!IsContiguous()) {
+      throw std::logic_error("DataView is not contiguous");
+    }
+    return {data_, Size()};
+  }
+  [[nodiscard]] DataView<const T> AsConst() const { return {data_, rows_, cols_, row_stride_}; }
+
+  // range-for over contiguous views
+  T *begin() const { return Span().data(); }          // NOLINT(readability-identifier-naming)
+  T *end() const { return Span().data() + Size(); }  // NOLINT(readability-identifier-naming)
+
+ private:
+  T *data_ = nullptr;
+  size_t rows_ = 0;
+  size_t cols_ = 0;
+  size_t row_stride_ = 0;
+};
+
+}  // namespace ppc::core
@@ -1,11 +1,20 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "core/mem/include/alloc_stats.hpp"
+#include "core/task/include/data_view.hpp"
+
 namespace ppc::core {
 
 struct TaskData {
@@ -14,14 +23,96 @@ struct TaskData {
   std::vector<uint8_t *> outputs;
   std::vector<std::uint32_t> outputs_count;
   enum StateOfTesting : uint8_t { kFunc, kPerf } state_of_testing;
+  // kTransferred: the caller does not use the input buffers after the run, the task may modify them in place
+  enum Ownership : uint8_t { kBorrowed, kTransferred } inputs_ownership = kBorrowed;
+  // dataset file (core/dataset) with the contents of inputs[0], set on every rank: MPI tasks that
+  // support it read the slice of each rank from the file instead of sending it from rank 0
+  std::string inputs_file;
+
+  // Typed views of the buffers without copying them, the 1D overloads take the size from inputs_count/outputs_count
+  template <typename T>
+  DataView<const T> InputView(size_t index) const {
+    return InputView<T>(index, 1, CheckedCount(inputs_count, index));
+  }
+  template <typename T>
+  DataView<const T> InputView(size_t index, size_t rows, size_t cols) const {
+    return {reinterpret_cast<const T *>(CheckedBuffer(inputs, index)), rows, cols, cols};
+  }
+  // throws if the inputs are borrowed from the caller
+  template <typename T>
+  DataView<T> MutableInputView(size_t index, size_t rows, size_t cols) const {
+    if (inputs_ownership != kTransferred) {
+      throw std::logic_error("TaskData inputs are borrowed and can not be modified");
+    }
+    return {reinterpret_cast<T *>(CheckedBuffer(inputs, index)), rows, cols, cols};
+  }
+  template <typename T>
+  DataView<T> MutableInputView(size_t index) const {
+    return MutableInputView<T>(index, 1, CheckedCount(inputs_count, index));
+  }
+  template <typename T>
+  DataView<T> OutputView(size_t index) const {
+    return OutputView<T>(index, 1, CheckedCount(outputs_count, index));
+  }
+  template <typename T>
+  DataView<T> OutputView(size_t index, size_t rows, size_t cols) const {
+    return {reinterpret_cast<T *>(CheckedBuffer(outputs, index)), rows, cols, cols};
+  }
+
+ private:
+  static uint8_t *CheckedBuffer(const std::vector<uint8_t *> &buffers, size_t index) {
+    if (index >= buffers.size()) {
+      throw std::out_of_range("TaskData buffer index is out of range");
+    }
+    return buffers[index];
+  }
+  static size_t CheckedCount(const std::vector<std::uint32_t> &counts, size_t index) {
+    if (index >= counts.size()) {
+      throw std::out_of_range("TaskData count index is out of range");
+    }
+    return counts[index];
+  }
 };
 
 using TaskDataPtr = std::shared_ptr<ppc::core::TaskData>;
 
+// thrown by a run that stopped because its token was cancelled or passed the deadline
+class TaskCancelled : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+// Stop flag with an optional deadline. Copies share the state, so the caller keeps one
+// copy to cancel and passes another to Task::RunAsync.
+class CancellationToken {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  CancellationToken();
+  static CancellationToken WithTimeout(Clock::duration timeout);
+
+  void Cancel() const;
+  void SetDeadline(Clock::time_point deadline) const;
+  // cancelled or past the deadline
+  [[nodiscard]] bool IsCancelled() const;
+
+ private:
+  struct State {
+    std::atomic<bool> cancelled = false;
+    std::atomic<Clock::rep> deadline = Clock::time_point::max().time_since_epoch().count();
+  };
+  std::shared_ptr<State> state_;
+};
+
 // Memory of inputs and outputs need to be initialized before create object of
 // Task class
 class Task {
  public:
+  enum Phase : uint8_t { kValidation, kPreProcessing, kRun, kPostProcessing };
+  constexpr static size_t kNumPhases = 4;
+  using PhaseTimes = std::array<std::vector<double>, kNumPhases>;
+  using PhaseMemory = std::array<MemoryStats, kNumPhases>;
+
   explicit Task(TaskDataPtr task_data);
 
   // set input and output data
@@ -42,12 +133,58 @@ class Task {
   // get input and output data
   [[nodiscard]] TaskDataPtr GetData() const;
 
+  // record wall time (in seconds) of every call of each phase
+  void SetPhaseProfiling(bool enabled);
+
+  // recorded phase times, indexed by Phase
+  [[nodiscard]] const PhaseTimes &GetPhaseTimes() const;
+
+  // record allocations and peak memory of every call of each phase (see MemoryTracker)
+  void SetMemoryProfiling(bool enabled);
+
+  // merged memory statistics of the recorded calls, indexed by Phase
+  [[nodiscard]] const PhaseMemory &GetPhaseMemory() const;
+
+  // clears recorded phase times and memory statistics
+  void ClearPhaseTimes();
+
+  static const char *GetPhaseName(Phase phase);
+
+  // Runs the whole pipeline for every item of the batch on this task, so scratch buffers
+  // and (for MPI tasks) the communicator are reused between items. The order and time
+  // checks of the single-item API are skipped. With validate_once only the first item is
+  // validated, the others must have the same shape; if it fails validation the batch stops
+  // and all items are reported as failed. MPI tasks have to be called on every rank with
+  // batches of the same length. result[i] is false if any phase of item i failed. task_data
+  // is restored afterwards.
+  std::vector<bool> RunBatch(const std::vector<TaskDataPtr> &batch, bool validate_once = false);
+
+  using Factory = std::function<std::shared_ptr<Task>(TaskDataPtr)>;
+  // Same as above, but the items are split between num_threads workers, each of them
+  // creates one task with the factory and reuses it (with validate_once every worker
+  // validates its first item, a failed one stops all workers). Not for MPI tasks.
+  static std::vector<bool> RunBatch(const Factory &factory, const std::vector<TaskDataPtr> &batch,
+                                    size_t num_threads, bool validate_once = false);
+
+  // Runs Validation, PreProcessing, Run and PostProcessing on a new thread. The future
+  // holds false if a phase failed and throws TaskCancelled if the token was cancelled or
+  // passed its deadline; RunImpl sees that through StopRequested(). Phases after a failed
+  // one are skipped and the task is ready for the next run. The task has to outlive the future.
+  std::future<bool> RunAsync(CancellationToken token = {});
+
   virtual ~Task();
 
  protected:
-  void InternalOrderTest(const std::string &str = __builtin_FUNCTION());
+  // Checks that phase follows the previous call (Validation, PreProcessing, Run repeated
+  // any number of times, PostProcessing) in constant time, and the time limit of func
+  // tests. Order checks are compiled out with PPC_DISABLE_ORDER_CHECKS.
+  void InternalOrderTest(Phase phase);
   TaskDataPtr task_data;
 
+  // true once the token of RunAsync is cancelled or past its deadline, and in func tests
+  // once the run is over the time limit; long RunImpl loops should poll it and give up
+  [[nodiscard]] bool StopRequested() const;
+
   // implementation of "validation" function
   virtual bool ValidationImpl() = 0;
 
@@ -61,10 +198,31 @@ class Task {
   virtual bool PostProcessingImpl() = 0;
 
  private:
-  std::vector<std::string> functions_order_;
-  std::vector<std::string> right_functions_order_ = {"Validation", "PreProcessing", "Run", "PostProcessing"};
+  // resets the order of a node that failed in the middle of its lifecycle
+  friend class TaskGraph;
+
+  bool ProfiledCall(Phase phase, bool (Task::*impl)());
+  enum class BatchItemResult : uint8_t { kDone, kFailed, kInvalid };
+  BatchItemResult RunBatchItem(TaskDataPtr item, bool validate);
+  void ResetOrder();
+
+  bool phase_profiling_ = false;
+  PhaseTimes phase_times_;
+  bool memory_profiling_ = false;
+  PhaseMemory phase_memory_;
+  // phase called last, a new cycle starts after kPostProcessing
+  Phase last_phase_ = kPostProcessing;
+  // lifecycle calls since SetData (repeated Run calls count once) and the first wrong
+  // one, which is reported again by every later call
+  uint64_t num_calls_ = 0;
+  uint64_t wrong_call_ = 0;
+  Phase wrong_phase_ = kValidation;
+  Phase expected_phase_ = kValidation;
   const double max_test_time_ = 1.0;
-  std::chrono::high_resolution_clock::time_point tmp_time_point_;
+  CancellationToken::Clock::time_point start_time_;
+  CancellationToken token_;
+  // end of the func test time budget, max outside of PreProcessing..PostProcessing
+  CancellationToken::Clock::time_point time_limit_ = CancellationToken::Clock::time_point::max();
 };
 
 }  // namespace ppc::core
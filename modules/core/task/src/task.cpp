@@ -1,15 +1,51 @@
 #include "core/task/include/task.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/mem/include/alloc_stats.hpp"
+
+ppc::core::CancellationToken::CancellationToken() : state_(std::make_shared<State>()) {}
+
+ppc::core::CancellationToken ppc::core::CancellationToken::WithTimeout(Clock::duration timeout) {
+  CancellationToken token;
+  token.SetDeadline(Clock::now() + timeout);
+  return token;
+}
+
+void ppc::core::CancellationToken::Cancel() const { state_->cancelled = true; }
+
+void ppc::core::CancellationToken::SetDeadline(Clock::time_point deadline) const {
+  state_->deadline = deadline.time_since_epoch().count();
+}
+
+bool ppc::core::CancellationToken::IsCancelled() const {
+  if (state_->cancelled.load(std::memory_order_relaxed)) {
+    return true;
+  }
+  const auto deadline = state_->deadline.load(std::memory_order_relaxed);
+  return deadline != Clock::time_point::max().time_since_epoch().count() &&
+         Clock::now().time_since_epoch().count() >= deadline;
+}
 
 void ppc::core::Task::SetData(TaskDataPtr task_data_ptr) {
   task_data_ptr->state_of_testing = TaskData::StateOfTesting::kFunc;
-  functions_order_.clear();
+  ResetOrder();
   this->task_data = std::move(task_data_ptr);
 }
 
@@ -18,47 +54,234 @@ ppc::core::TaskDataPtr ppc::core::Task::GetData() const { return task_data; }
 ppc::core::Task::Task(TaskDataPtr task_data) { SetData(std::move(task_data)); }
 
 bool ppc::core::Task::Validation() {
-  InternalOrderTest();
-  return ValidationImpl();
+  InternalOrderTest(kValidation);
+  return ProfiledCall(kValidation, &Task::ValidationImpl);
 }
 
 bool ppc::core::Task::PreProcessing() {
-  InternalOrderTest();
-  return PreProcessingImpl();
+  InternalOrderTest(kPreProcessing);
+  return ProfiledCall(kPreProcessing, &Task::PreProcessingImpl);
 }
 
 bool ppc::core::Task::Run() {
-  InternalOrderTest();
-  return RunImpl();
+  InternalOrderTest(kRun);
+  return ProfiledCall(kRun, &Task::RunImpl);
 }
 
 bool ppc::core::Task::PostProcessing() {
-  InternalOrderTest();
-  return PostProcessingImpl();
+  InternalOrderTest(kPostProcessing);
+  return ProfiledCall(kPostProcessing, &Task::PostProcessingImpl);
 }
 
-void ppc::core::Task::InternalOrderTest(const std::string& str) {
-  if (!functions_order_.empty() && str == functions_order_.back() && str == "Run") {
-    return;
+void ppc::core::Task::SetPhaseProfiling(bool enabled) { phase_profiling_ = enabled; }
+
+const ppc::core::Task::PhaseTimes& ppc::core::Task::GetPhaseTimes() const { return phase_times_; }
+
+void ppc::core::Task::SetMemoryProfiling(bool enabled) { memory_profiling_ = enabled; }
+
+const ppc::core::Task::PhaseMemory& ppc::core::Task::GetPhaseMemory() const { return phase_memory_; }
+
+void ppc::core::Task::ClearPhaseTimes() {
+  for (auto& times : phase_times_) {
+    times.clear();
+  }
+  phase_memory_ = {};
+}
+
+const char* ppc::core::Task::GetPhaseName(Phase phase) {
+  switch (phase) {
+    case kValidation:
+      return "Validation";
+    case kPreProcessing:
+      return "PreProcessing";
+    case kRun:
+      return "Run";
+    case kPostProcessing:
+      return "PostProcessing";
+  }
+  return "Unknown";
+}
+
+bool ppc::core::Task::ProfiledCall(Phase phase, bool (Task::*impl)()) {
+  if (!phase_profiling_ && !memory_profiling_) {
+    return (this->*impl)();
+  }
+  // a tracker of another task running at the same time (RunAsync, TaskGraph) keeps this
+  // call from being measured
+  MemoryTracker memory_tracker;
+  const bool tracking = memory_profiling_ && memory_tracker.Start();
+  auto begin = std::chrono::high_resolution_clock::now();
+  bool res = (this->*impl)();
+  auto end = std::chrono::high_resolution_clock::now();
+  if (tracking) {
+    phase_memory_[phase] += memory_tracker.Stop();
+  }
+  if (phase_profiling_) {
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    phase_times_[phase].push_back(static_cast<double>(duration) * 1e-9);
+  }
+  return res;
+}
+
+ppc::core::Task::BatchItemResult ppc::core::Task::RunBatchItem(TaskDataPtr item, bool validate) {
+  task_data = std::move(item);
+  if (validate && !ProfiledCall(kValidation, &Task::ValidationImpl)) {
+    return BatchItemResult::kInvalid;
   }
+  const bool done = ProfiledCall(kPreProcessing, &Task::PreProcessingImpl) && ProfiledCall(kRun, &Task::RunImpl) &&
+                    ProfiledCall(kPostProcessing, &Task::PostProcessingImpl);
+  return done ? BatchItemResult::kDone : BatchItemResult::kFailed;
+}
+
+std::vector<bool> ppc::core::Task::RunBatch(const std::vector<TaskDataPtr>& batch, bool validate_once) {
+  std::vector<bool> results(batch.size(), false);
+  // task_data is restored also when an item throws
+  struct RestoreData {
+    Task &task;
+    TaskDataPtr original;
+    ~RestoreData() { task.task_data = std::move(original); }
+  } restore{.task = *this, .original = task_data};
+  bool validated = false;
+  for (size_t i = 0; i < batch.size(); i++) {
+    const auto result = RunBatchItem(batch[i], !validate_once || !validated);
+    // the other items have the same shape, none of them would pass either
+    if (validate_once && result == BatchItemResult::kInvalid) {
+      break;
+    }
+    validated = true;
+    results[i] = result == BatchItemResult::kDone;
+  }
+  return results;
+}
+
+std::vector<bool> ppc::core::Task::RunBatch(const Factory& factory, const std::vector<TaskDataPtr>& batch,
+                                            size_t num_threads, bool validate_once) {
+  num_threads = std::clamp<size_t>(num_threads, 1, std::max<size_t>(batch.size(), 1));
+  // std::vector<bool> can not be written from several threads
+  std::vector<uint8_t> results(batch.size(), 0);
+  std::atomic<size_t> next = 0;
+  std::mutex mutex;
+  std::exception_ptr error;
+
+  auto worker = [&] {
+    std::shared_ptr<Task> task;
+    try {
+      bool validated = false;
+      for (size_t i = next++; i < batch.size(); i = next++) {
+        if (!task) {
+          task = factory(batch[i]);
+        }
+        const auto result = task->RunBatchItem(batch[i], !validate_once || !validated);
+        if (validate_once && result == BatchItemResult::kInvalid) {
+          // stops the other workers as well, the remaining items stay failed
+          next = batch.size();
+          break;
+        }
+        validated = true;
+        results[i] = static_cast<uint8_t>(result == BatchItemResult::kDone);
+      }
+    } catch (...) {
+      std::lock_guard lock(mutex);
+      error = error ? error : std::current_exception();
+      next = batch.size();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t i = 0; i + 1 < num_threads; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return {results.begin(), results.end()};
+}
 
-  functions_order_.push_back(str);
+bool ppc::core::Task::StopRequested() const {
+  return token_.IsCancelled() ||
+         (time_limit_ != CancellationToken::Clock::time_point::max() && CancellationToken::Clock::now() > time_limit_);
+}
 
-  for (size_t i = 0; i < functions_order_.size(); i++) {
-    if (functions_order_[i] != right_functions_order_[i % right_functions_order_.size()]) {
-      throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
-                                  std::to_string(i + 1) + "\n" + std::string("Yours function: ") + functions_order_[i] +
-                                  "\n" + std::string("Expected function: ") + right_functions_order_[i]);
+std::future<bool> ppc::core::Task::RunAsync(CancellationToken token) {
+  token_ = std::move(token);
+  return std::async(std::launch::async, [this] {
+    auto finish = [this] {
+      // a failed or cancelled run leaves the lifecycle in the middle, start over next time
+      ResetOrder();
+      const bool cancelled = token_.IsCancelled();
+      token_ = {};
+      return cancelled;
+    };
+    try {
+      bool res = !token_.IsCancelled() && Validation();
+      res = res && !token_.IsCancelled() && PreProcessing();
+      res = res && !token_.IsCancelled() && Run();
+      res = res && !token_.IsCancelled() && PostProcessing();
+      if (res) {
+        token_ = {};
+        return true;
+      }
+    } catch (...) {
+      finish();
+      throw;
     }
+    if (finish()) {
+      throw TaskCancelled("Task run was cancelled or passed its deadline");
+    }
+    return false;
+  });
+}
+
+void ppc::core::Task::ResetOrder() {
+  last_phase_ = kPostProcessing;
+  num_calls_ = 0;
+  wrong_call_ = 0;
+  time_limit_ = CancellationToken::Clock::time_point::max();
+}
+
+void ppc::core::Task::InternalOrderTest(Phase phase) {
+  if (phase == kRun && last_phase_ == kRun) {
+    return;
+  }
+
+#ifndef PPC_DISABLE_ORDER_CHECKS
+  num_calls_++;
+  const auto expected = static_cast<Phase>((last_phase_ + 1) % kNumPhases);
+  last_phase_ = phase;
+  if (wrong_call_ == 0 && phase != expected) {
+    wrong_call_ = num_calls_;
+    wrong_phase_ = phase;
+    expected_phase_ = expected;
   }
+  if (wrong_call_ != 0) {
+    throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
+                                std::to_string(wrong_call_) + "\n" + std::string("Yours function: ") +
+                                GetPhaseName(wrong_phase_) + "\n" + std::string("Expected function: ") +
+                                GetPhaseName(expected_phase_));
+  }
+#else
+  last_phase_ = phase;
+#endif
 
-  if (str == "PreProcessing" && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
-    tmp_time_point_ = std::chrono::high_resolution_clock::now();
+  if (task_data->state_of_testing != TaskData::StateOfTesting::kFunc) {
+    return;
+  }
+  if (phase == kPreProcessing) {
+    start_time_ = CancellationToken::Clock::now();
+    time_limit_ = start_time_ + std::chrono::duration_cast<CancellationToken::Clock::duration>(
+                                    std::chrono::duration<double>(max_test_time_));
   }
 
-  if (str == "PostProcessing" && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - tmp_time_point_).count();
+  if (phase == kPostProcessing) {
+    time_limit_ = CancellationToken::Clock::time_point::max();
+    auto end = CancellationToken::Clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start_time_).count();
     auto current_time = static_cast<double>(duration) * 1e-9;
     if (current_time < max_test_time_) {
       std::cout << "Test time:" << std::fixed << std::setprecision(10) << current_time;
@@ -72,4 +295,4 @@ void ppc::core::Task::InternalOrderTest(const std::string& str) {
   }
 }
 
-ppc::core::Task::~Task() { functions_order_.clear(); }
+ppc::core::Task::~Task() = default;
@@ -3,9 +3,14 @@
 #include <cstdlib>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "core/util/include/util.hpp"
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 TEST(util_tests, check_unset_env) {
 #ifndef _WIN32
   int save_var = ppc::util::GetPPCNumThreads();
@@ -34,3 +39,69 @@ TEST(util_tests, check_set_env) {
   GTEST_SKIP();
 #endif
 }
+
+TEST(util_tests, check_affinity_plan) {
+  // 2 nodes x 2 cores x 2 SMT siblings, siblings numbered as cpu and cpu + 4
+  std::vector<ppc::util::CpuInfo> topology;
+  for (int cpu = 0; cpu < 8; cpu++) {
+    int core = cpu % 4;
+    topology.push_back({.cpu = cpu, .core = core, .package = core / 2, .numa_node = core / 2});
+  }
+
+  using ppc::util::Affinity;
+  EXPECT_TRUE(ppc::util::PlanAffinity(topology, 4, Affinity::kNone).empty());
+  EXPECT_EQ(ppc::util::PlanAffinity(topology, 4, Affinity::kCompact), std::vector<int>({0, 4, 1, 5}));
+  EXPECT_EQ(ppc::util::PlanAffinity(topology, 4, Affinity::kScatter), std::vector<int>({0, 2, 1, 3}));
+  EXPECT_EQ(ppc::util::PlanAffinity(topology, 10, Affinity::kScatter),
+            std::vector<int>({0, 2, 1, 3, 4, 6, 5, 7, 0, 2}));
+}
+
+TEST(util_tests, check_topology_and_pinning) {
+  const auto &topology = ppc::util::GetCpuTopology();
+  ASSERT_FALSE(topology.empty());
+  EXPECT_GE(ppc::util::GetCurrentNumaNode(), 0);
+
+  std::vector<char> buffer(3 * 4096 + 1, 1);
+  ppc::util::FirstTouch(buffer.data(), buffer.size());
+  EXPECT_EQ(buffer[0], 0);
+  EXPECT_EQ(buffer[1], 1);
+
+#ifndef _WIN32
+  unsetenv("PPC_AFFINITY");  // NOLINT(misc-include-cleaner)
+  EXPECT_EQ(ppc::util::GetPPCAffinity(), ppc::util::Affinity::kNone);
+  EXPECT_FALSE(ppc::util::PinCurrentThread(0, 1));
+
+  // pin a separate thread, so the test runner is not restricted to one cpu
+  setenv("PPC_AFFINITY", "compact", 1);  // NOLINT(misc-include-cleaner)
+  EXPECT_EQ(ppc::util::GetPPCAffinity(), ppc::util::Affinity::kCompact);
+  bool pinned = false;
+  std::thread([&pinned] { pinned = ppc::util::PinCurrentThread(0, 1); }).join();
+#ifdef __linux__
+  EXPECT_TRUE(pinned);
+#endif
+  unsetenv("PPC_AFFINITY");  // NOLINT(misc-include-cleaner)
+#endif
+}
+
+TEST(util_tests, check_scoped_affinity_restores_mask) {
+#ifdef __linux__
+  const auto plan = ppc::util::PlanAffinity(ppc::util::GetCpuTopology(), 1, ppc::util::Affinity::kCompact);
+  ASSERT_EQ(plan.size(), 1U);
+  std::thread([&plan] {
+    cpu_set_t before;
+    CPU_ZERO(&before);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(before), &before), 0);
+    {
+      const ppc::util::ScopedAffinity affinity;
+      ASSERT_TRUE(ppc::util::PinCurrentThread(plan, 0));
+      EXPECT_FALSE(ppc::util::PinCurrentThread(plan, 1));
+    }
+    cpu_set_t after;
+    CPU_ZERO(&after);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(after), &after), 0);
+    EXPECT_NE(CPU_EQUAL(&before, &after), 0);
+  }).join();
+#else
+  GTEST_SKIP();
+#endif
+}
@@ -1,9 +1,66 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace ppc::util {
 
 std::string GetAbsolutePath(const std::string &relative_path);
+// value of environment variable, empty string if it is not set
+std::string GetEnv(const std::string &name);
 int GetPPCNumThreads();
+// work multiplier for weak scaling runs (PPC_PERF_SCALE), 1.0 if not set: perf tests size
+// their input so that the amount of work, not the input, grows linearly with it
+double GetPerfScale();
+
+struct CpuInfo {
+  int cpu;
+  int core;
+  int package;
+  int numa_node;
+};
+
+// logical cpus the process may run on, read from /sys on Linux (one node and one core
+// per cpu elsewhere), cached after the first call
+const std::vector<CpuInfo> &GetCpuTopology();
+
+enum class Affinity : uint8_t { kNone, kCompact, kScatter };
+// PPC_AFFINITY=compact|scatter, kNone if not set
+Affinity GetPPCAffinity();
+
+// cpu of each of num_threads workers. kCompact fills the SMT siblings of a core, then the
+// cores of a node before moving to the next one; kScatter spreads the workers over the
+// nodes first and uses SMT siblings last. Empty for kNone.
+std::vector<int> PlanAffinity(const std::vector<CpuInfo> &topology, int num_threads, Affinity affinity);
+
+// pins the calling thread to the cpu planned for worker index of num_threads under
+// GetPPCAffinity(); false if the policy is kNone or pinning is not supported
+bool PinCurrentThread(int index, int num_threads);
+// pins the calling thread to plan[index] of a plan made ahead with PlanAffinity, so a timed
+// region does not read the environment and the topology; false if index is not in the plan
+bool PinCurrentThread(const std::vector<int> &plan, int index);
+
+// saves the cpu mask of the calling thread and restores it on destruction: new threads
+// inherit the mask of their creator, so a thread that is pinned only for one parallel region
+// (thread 0 of OpenMP, the caller of a TBB arena) has to get its mask back afterwards
+class ScopedAffinity {
+ public:
+  ScopedAffinity();
+  ScopedAffinity(const ScopedAffinity &) = delete;
+  ScopedAffinity &operator=(const ScopedAffinity &) = delete;
+  ~ScopedAffinity();
+
+ private:
+  // cpus of the saved mask, empty if it could not be read
+  std::vector<int> cpus_;
+};
+
+// NUMA node of the cpu the calling thread runs on, 0 if unknown
+int GetCurrentNumaNode();
+
+// zeroes one byte per page from the calling thread: pages of fresh memory are placed on
+// the node of the first thread that writes them, so each pinned worker should touch its part
+void FirstTouch(void *data, size_t bytes);
 
 }  // namespace ppc::util
@@ -1,32 +1,239 @@
 #include "core/util/include/util.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdlib>
-#ifdef _WIN32
-#include <cstdint>
-#include <iostream>
-#include <memory>
-#include <vector>
-#endif
-
 #include <filesystem>
+#include <fstream>
+#include <map>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#endif
 
 std::string ppc::util::GetAbsolutePath(const std::string &relative_path) {
   const std::filesystem::path path = std::string(PPC_PATH_TO_PROJECT) + "/tasks/" + relative_path;
   return path.string();
 }
 
-int ppc::util::GetPPCNumThreads() {
+std::string ppc::util::GetEnv(const std::string &name) {
 #ifdef _WIN32
-  size_t len;
-  char omp_env[100];
-  errno_t err = getenv_s(&len, omp_env, sizeof(omp_env), "OMP_NUM_THREADS");
-  if (err != 0 || len == 0) {
-    omp_env[0] = '\0';
+  char *value = nullptr;
+  size_t len = 0;
+  if (_dupenv_s(&value, &len, name.c_str()) != 0 || value == nullptr) {
+    return {};
   }
+  std::string res(value);
+  free(value);
+  return res;
 #else
-  const char *omp_env = std::getenv("OMP_NUM_THREADS");
+  const char *value = std::getenv(name.c_str());
+  return value != nullptr ? std::string(value) : std::string();
 #endif
-  int num_threads = (omp_env != nullptr) ? std::atoi(omp_env) : 1;
+}
+
+int ppc::util::GetPPCNumThreads() {
+  const auto omp_env = GetEnv("OMP_NUM_THREADS");
+  int num_threads = !omp_env.empty() ? std::atoi(omp_env.c_str()) : 1;
   return num_threads;
 }
+
+double ppc::util::GetPerfScale() {
+  const auto scale_env = GetEnv("PPC_PERF_SCALE");
+  double scale = !scale_env.empty() ? std::atof(scale_env.c_str()) : 1.0;
+  return scale > 0.0 ? scale : 1.0;
+}
+
+namespace {
+
+#ifdef __linux__
+int ReadSysInt(const std::filesystem::path &path, int fallback) {
+  std::ifstream file(path);
+  int value = fallback;
+  if (!(file >> value)) {
+    return fallback;
+  }
+  return value;
+}
+
+std::vector<ppc::util::CpuInfo> ReadCpuTopology() {
+  std::vector<ppc::util::CpuInfo> topology;
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    return topology;
+  }
+  const std::filesystem::path cpu_root = "/sys/devices/system/cpu";
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &allowed) == 0) {
+      continue;
+    }
+    const auto cpu_dir = cpu_root / ("cpu" + std::to_string(cpu));
+    ppc::util::CpuInfo info{.cpu = cpu,
+                            .core = ReadSysInt(cpu_dir / "topology" / "core_id", cpu),
+                            .package = ReadSysInt(cpu_dir / "topology" / "physical_package_id", 0),
+                            .numa_node = 0};
+    std::error_code ec;
+    for (const auto &entry : std::filesystem::directory_iterator(cpu_dir, ec)) {
+      const auto name = entry.path().filename().string();
+      if (name.starts_with("node") && name.size() > 4) {
+        info.numa_node = std::atoi(name.c_str() + 4);
+      }
+    }
+    topology.push_back(info);
+  }
+  return topology;
+}
+#endif
+
+}  // namespace
+
+const std::vector<ppc::util::CpuInfo> &ppc::util::GetCpuTopology() {
+  static const std::vector<CpuInfo> kTopology = [] {
+    std::vector<CpuInfo> topology;
+#ifdef __linux__
+    topology = ReadCpuTopology();
+#endif
+    if (topology.empty()) {
+      const int num_cpus = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+      for (int cpu = 0; cpu < num_cpus; cpu++) {
+        topology.push_back({.cpu = cpu, .core = cpu, .package = 0, .numa_node = 0});
+      }
+    }
+    return topology;
+  }();
+  return kTopology;
+}
+
+ppc::util::Affinity ppc::util::GetPPCAffinity() {
+  const auto affinity_env = GetEnv("PPC_AFFINITY");
+  if (affinity_env == "compact") {
+    return Affinity::kCompact;
+  }
+  if (affinity_env == "scatter") {
+    return Affinity::kScatter;
+  }
+  return Affinity::kNone;
+}
+
+std::vector<int> ppc::util::PlanAffinity(const std::vector<CpuInfo> &topology, int num_threads, Affinity affinity) {
+  if (affinity == Affinity::kNone || topology.empty() || num_threads <= 0) {
+    return {};
+  }
+
+  // index of every cpu among the SMT siblings of its core
+  std::map<std::tuple<int, int>, int> siblings;
+  std::vector<std::tuple<int, int, int, int, int>> keyed;  // node, smt rank, package, core, cpu
+  auto sorted = topology;
+  std::ranges::sort(sorted, {}, [](const CpuInfo &info) { return info.cpu; });
+  for (const auto &info : sorted) {
+    int smt_rank = siblings[{info.package, info.core}]++;
+    keyed.emplace_back(info.numa_node, smt_rank, info.package, info.core, info.cpu);
+  }
+
+  std::vector<int> order;
+  if (affinity == Affinity::kCompact) {
+    std::ranges::sort(keyed, {}, [](const auto &key) {
+      const auto &[node, smt_rank, package, core, cpu] = key;
+      return std::make_tuple(node, package, core, smt_rank, cpu);
+    });
+    for (const auto &key : keyed) {
+      order.push_back(std::get<4>(key));
+    }
+  } else {
+    // per node first siblings of all cores, then the second ones, ...; nodes interleaved
+    std::ranges::sort(keyed);
+    std::map<int, std::vector<int>> per_node;
+    for (const auto &key : keyed) {
+      per_node[std::get<0>(key)].push_back(std::get<4>(key));
+    }
+    for (size_t i = 0; order.size() < keyed.size(); i++) {
+      for (const auto &[node, cpus] : per_node) {
+        if (i < cpus.size()) {
+          order.push_back(cpus[i]);
+        }
+      }
+    }
+  }
+
+  std::vector<int> plan(num_threads);
+  for (int i = 0; i < num_threads; i++) {
+    plan[i] = order[i % order.size()];
+  }
+  return plan;
+}
+
+bool ppc::util::PinCurrentThread(int index, int num_threads) {
+  return PinCurrentThread(PlanAffinity(GetCpuTopology(), num_threads, GetPPCAffinity()), index);
+}
+
+bool ppc::util::PinCurrentThread(const std::vector<int> &plan, int index) {
+  if (index < 0 || index >= static_cast<int>(plan.size())) {
+    return false;
+  }
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(plan[index], &set);
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+  return false;
+#endif
+}
+
+ppc::util::ScopedAffinity::ScopedAffinity() {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &set) != 0) {
+        cpus_.push_back(cpu);
+      }
+    }
+  }
+#endif
+}
+
+ppc::util::ScopedAffinity::~ScopedAffinity() {
+#ifdef __linux__
+  if (cpus_.empty()) {
+    return;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus_) {
+    CPU_SET(cpu, &set);
+  }
+  sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
+
+int ppc::util::GetCurrentNumaNode() {
+#ifdef __linux__
+  const int cpu = sched_getcpu();
+  for (const auto &info : GetCpuTopology()) {
+    if (info.cpu == cpu) {
+      return info.numa_node;
+    }
+  }
+#endif
+  return 0;
+}
+
+void ppc::util::FirstTouch(void *data, size_t bytes) {
+#ifdef __linux__
+  const auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+  const size_t page = 4096;
+#endif
+  auto *bytes_ptr = static_cast<volatile char *>(data);
+  for (size_t offset = 0; offset < bytes; offset += page) {
+    bytes_ptr[offset] = 0;
+  }
+}
@@ -0,0 +1,194 @@
+import csv
+import json
+import os
+import platform
+import subprocess
+import tempfile
+from pathlib import Path
+
+
+def init_cmd_args():
+    import argparse
+    parser = argparse.ArgumentParser(
+        description="Re-run a perf test over several thread/process counts and print scaling tables."
+    )
+    parser.add_argument(
+        "--executable",
+        required=True,
+        help="Perf tests binary, e.g. 'mpi_perf_tests' (looked up in build/bin and install/bin) or a path."
+    )
+    parser.add_argument(
+        "--gtest-filter",
+        required=False,
+        default="*",
+        help="Perf test(s) to run, e.g. 'nesterov_a_test_task_mpi.test_pipeline_run'."
+    )
+    parser.add_argument(
+        "--threads",
+        required=False,
+        default="1",
+        help="Comma separated list of OMP_NUM_THREADS values (default: 1)."
+    )
+    parser.add_argument(
+        "--processes",
+        required=False,
+        default="",
+        help="Comma separated list of mpirun -np values, empty to run without mpirun (default)."
+    )
+    parser.add_argument(
+        "--scaling",
+        required=False,
+        default="strong",
+        choices=["strong", "weak"],
+        help="'strong' keeps the input fixed, 'weak' sets PPC_PERF_SCALE to processes * threads "
+             "(tests size their input so the work grows linearly with it)."
+    )
+    parser.add_argument(
+        "--mode",
+        required=False,
+        default="pipeline",
+        choices=["pipeline", "task_run"],
+        help="Perf mode the tables are built for."
+    )
+    parser.add_argument(
+        "--output",
+        required=False,
+        default="",
+        help="Write the scaling table to this CSV file (optional)."
+    )
+    parser.add_argument(
+        "--additional-mpi-args",
+        required=False,
+        default="",
+        help="Additional MPI arguments to pass to the mpirun command (optional)."
+    )
+    args = parser.parse_args()
+    _args_dict = vars(args)
+    return _args_dict
+
+
+def parse_counts(value):
+    return [int(x) for x in value.split(",") if x.strip()]
+
+
+def find_executable(name):
+    if os.path.isfile(name):
+        return Path(name).resolve()
+    project_path = Path(__file__).resolve().parent.parent
+    suffix = ".exe" if platform.system() == "Windows" else ""
+    for work_dir in ["build/bin", "install/bin"]:
+        candidate = project_path / work_dir / (name + suffix)
+        if candidate.is_file():
+            return candidate
+    raise FileNotFoundError(f"Perf tests binary '{name}' is not found")
+
+
+def run_config(executable, gtest_filter, threads, processes, scale, additional_mpi_args):
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        report_path = Path(tmp_dir) / "perf_report.jsonl"
+        env = os.environ.copy()
+        env["OMP_NUM_THREADS"] = str(threads)
+        env["PPC_PERF_SCALE"] = str(scale)
+        env["PPC_PERF_REPORT"] = str(report_path)
+
+        command = [str(executable), f"--gtest_filter={gtest_filter}"]
+        if processes > 0:
+            mpi_exec = "mpiexec" if platform.system() == "Windows" else "mpirun"
+            command = [mpi_exec] + additional_mpi_args.split() + ["-np", str(processes)] + command
+        print(f"[sweep] OMP_NUM_THREADS={threads} PPC_PERF_SCALE={scale} {' '.join(command)}")
+        result = subprocess.run(command, env=env, stdout=subprocess.DEVNULL)
+        if result.returncode != 0:
+            print(f"[sweep] command failed with exit code {result.returncode}")
+
+        records = []
+        if report_path.is_file():
+            with open(report_path, "r") as file:
+                for line in file:
+                    if line.strip():
+                        records.append(json.loads(line))
+        return records
+
+
+def karp_flatt(speedup, workers):
+    # experimentally determined serial fraction, undefined for a single worker
+    if workers <= 1 or speedup <= 0.0:
+        return None
+    return (1.0 / speedup - 1.0 / workers) / (1.0 - 1.0 / workers)
+
+
+def build_table(points, scaling):
+    # points: list of (workers, processes, threads, input_size, time), baseline is the smallest worker count
+    points = sorted(points, key=lambda p: p[0])
+    base_workers, _, _, _, base_time = points[0]
+    table = []
+    for workers, processes, threads, input_size, time in points:
+        relative = workers / base_workers
+        if scaling == "strong":
+            speedup = base_time / time if time > 0.0 else 0.0
+        else:
+            # scaled speedup (Gustafson): the amount of work grows with the worker count
+            speedup = relative * base_time / time if time > 0.0 else 0.0
+        efficiency = speedup / relative
+        table.append({
+            "processes": processes,
+            "threads": threads,
+            "workers": workers,
+            "input_size": input_size,
+            "time_sec": time,
+            "speedup": speedup,
+            "efficiency": efficiency,
+            "karp_flatt": karp_flatt(speedup, relative),
+        })
+    return table
+
+
+def print_table(name, table):
+    print(f"\n{name}")
+    header = (f"{'np':>4} {'threads':>8} {'input_size':>12} {'time, s':>12} "
+              f"{'speedup':>9} {'efficiency':>11} {'karp-flatt':>11}")
+    print(header)
+    print("-" * len(header))
+    for row in table:
+        karp_flatt_str = f"{row['karp_flatt']:.4f}" if row["karp_flatt"] is not None else "-"
+        print(f"{row['processes']:>4} {row['threads']:>8} {row['input_size']:>12} {row['time_sec']:>12.6f} "
+              f"{row['speedup']:>9.3f} {row['efficiency']:>11.3f} {karp_flatt_str:>11}")
+
+
+if __name__ == "__main__":
+    args_dict = init_cmd_args()
+    executable = find_executable(args_dict["executable"])
+    thread_counts = parse_counts(args_dict["threads"]) or [1]
+    process_counts = parse_counts(args_dict["processes"]) or [0]
+
+    # (backend, task) -> list of points
+    results = {}
+    for processes in process_counts:
+        for threads in thread_counts:
+            workers = max(processes, 1) * threads
+            scale = workers if args_dict["scaling"] == "weak" else 1
+            records = run_config(executable, args_dict["gtest_filter"], threads, processes, scale,
+                                 args_dict["additional_mpi_args"])
+            for record in records:
+                if record.get("mode") != args_dict["mode"]:
+                    continue
+                key = (record["backend"], record["task"])
+                results.setdefault(key, []).append(
+                    (workers, max(processes, 1), threads, record.get("input_size", 0), record["time_sec"]))
+
+    if not results:
+        raise RuntimeError("No perf records were collected, check --executable and --gtest-filter")
+
+    rows = []
+    for (backend, task), points in sorted(results.items()):
+        table = build_table(points, args_dict["scaling"])
+        print_table(f"{backend}/{task} ({args_dict['scaling']} scaling, {args_dict['mode']})", table)
+        for row in table:
+            rows.append({"backend": backend, "task": task, **row})
+
+    if args_dict["output"]:
+        with open(args_dict["output"], "w", newline="") as file:
+            writer = csv.DictWriter(file, fieldnames=list(rows[0].keys()))
+            writer.writeheader()
+            for row in rows:
+                writer.writerow({k: ("" if v is None else v) for k, v in row.items()})
+        print(f"\nScaling table is written to {args_dict['output']}")
@@ -1,6 +1,5 @@
 #include <gtest/gtest.h>
 
-#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -35,12 +34,7 @@ TEST(nesterov_a_test_task_all, test_pipeline_run) {
   // Create Perf attributes
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
-  const auto t0 = std::chrono::high_resolution_clock::now();
-  perf_attr->current_timer = [&] {
-    auto current_time_point = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
-    return static_cast<double>(duration) * 1e-9;
-  };
+  perf_attr->timer = ppc::core::TimerKind::kSteady;
 
   // Create and init perf results
   auto perf_results = std::make_shared<ppc::core::PerfResults>();
@@ -80,12 +74,7 @@ TEST(nesterov_a_test_task_all, test_task_run) {
   // Create Perf attributes
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
-  const auto t0 = std::chrono::high_resolution_clock::now();
-  perf_attr->current_timer = [&] {
-    auto current_time_point = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
-    return static_cast<double>(duration) * 1e-9;
-  };
+  perf_attr->timer = ppc::core::TimerKind::kSteady;
 
   // Create and init perf results
   auto perf_results = std::make_shared<ppc::core::PerfResults>();
@@ -2,7 +2,9 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -10,7 +12,7 @@
 
 namespace konstantinov_i_sum_of_vector_elements_mpi {
 
-int VecElemSum(const std::vector<int>& vec);
+int VecElemSum(std::span<const int> vec);
 
 class SumVecElemSequential : public ppc::core::Task {
  public:
@@ -21,7 +23,9 @@ class SumVecElemSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> input_;
+  // rows are summed in place through TaskData views
+  size_t rows_{};
+  size_t columns_{};
   int result_{};
 };
 
@@ -34,7 +38,7 @@ class SumVecElemParallel : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> input_, output_;
+  std::vector<int> input_;
   int result_{};
   boost::mpi::communicator world_;
 };
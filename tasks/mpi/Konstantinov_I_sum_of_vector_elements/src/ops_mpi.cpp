@@ -1,16 +1,14 @@
 #include "mpi/Konstantinov_I_sum_of_vector_elements/include/ops_mpi.hpp"
 
 #include <algorithm>
-#include <boost/mpi/collectives.hpp>
-#include <boost/mpi/collectives/broadcast.hpp>
-#include <boost/mpi/collectives/reduce.hpp>
-#include <boost/mpi/collectives/scatterv.hpp>
-#include <boost/mpi/communicator.hpp>
-#include <cmath>
+#include <cstddef>
 #include <functional>
+#include <span>
 #include <vector>
 
-int konstantinov_i_sum_of_vector_elements_mpi::VecElemSum(const std::vector<int>& vec) {
+#include "core/dist/include/map_reduce_mpi.hpp"
+
+int konstantinov_i_sum_of_vector_elements_mpi::VecElemSum(std::span<const int> vec) {
   int result = 0;
   for (int elem : vec) {
     result += elem;
@@ -19,18 +17,8 @@ int konstantinov_i_sum_of_vector_elements_mpi::VecElemSum(const std::vector<int>
 }
 
 bool konstantinov_i_sum_of_vector_elements_mpi::SumVecElemSequential::PreProcessingImpl() {
-  int rows = static_cast<int>(task_data->inputs_count[0]);
-  int columns = static_cast<int>(task_data->inputs_count[1]);
-
-  input_ = std::vector<int>(rows * columns);
-
-  for (int i = 0; i < rows; i++) {
-    auto* el = reinterpret_cast<int*>(task_data->inputs[i]);
-    for (int j = 0; j < columns; j++) {
-      input_[(i * columns) + j] = el[j];
-    }
-  }
-
+  rows_ = task_data->inputs_count[0];
+  columns_ = task_data->inputs_count[1];
   return true;
 }
 
@@ -40,7 +28,10 @@ bool konstantinov_i_sum_of_vector_elements_mpi::SumVecElemSequential::Validation
 }
 
 bool konstantinov_i_sum_of_vector_elements_mpi::SumVecElemSequential::RunImpl() {
-  result_ = VecElemSum(input_);
+  result_ = 0;
+  for (size_t i = 0; i < rows_; i++) {
+    result_ += VecElemSum(task_data->InputView<int>(i, 1, columns_).Row(0));
+  }
   return true;
 }
 
@@ -54,13 +45,10 @@ bool konstantinov_i_sum_of_vector_elements_mpi::SumVecElemParallel::PreProcessin
     int rows = static_cast<int>(task_data->inputs_count[0]);
     int columns = static_cast<int>(task_data->inputs_count[1]);
 
+    // scatterv needs the rows in one contiguous buffer
     input_ = std::vector<int>(rows * columns);
-
     for (int i = 0; i < rows; i++) {
-      auto* p = reinterpret_cast<int*>(task_data->inputs[i]);
-      for (int j = 0; j < columns; j++) {
-        input_[(i * columns) + j] = p[j];
-      }
+      std::ranges::copy(task_data->InputView<int>(i, 1, columns).Row(0), input_.begin() + (i * columns));
     }
   }
 
@@ -76,33 +64,9 @@ bool konstantinov_i_sum_of_vector_elements_mpi::SumVecElemParallel::ValidationIm
 }
 
 bool konstantinov_i_sum_of_vector_elements_mpi::SumVecElemParallel::RunImpl() {
-  unsigned int input_size = 0;
-  int local_rank = world_.rank();
-  int world_size = world_.size();
-  if (local_rank == 0) {
-    input_size = input_.size();
-  }
-  broadcast(world_, input_size, 0);
-
-  int elem_per_procces = static_cast<int>(input_size / world_size);
-  int residual_elements = static_cast<int>(input_size % world_size);
-
-  int process_count = elem_per_procces + (local_rank < residual_elements ? 1 : 0);
-
-  std::vector<int> counts(world_size);
-  std::vector<int> displacment(world_size);
-
-  for (int i = 0; i < world_size; i++) {
-    counts[i] = elem_per_procces + (i < residual_elements ? 1 : 0);
-    displacment[i] = i * elem_per_procces + std::min(i, residual_elements);
-  }
-
-  output_.resize(counts[local_rank]);
-  boost::mpi::scatterv(world_, input_.data(), counts, displacment, output_.data(), process_count, 0);
-
-  int process_sum = VecElemSum(output_);
-  boost::mpi::reduce(world_, process_sum, result_, std::plus(), 0);
-
+  result_ = ppc::core::MapReduce(
+      world_, input_.data(), input_.size(), 0, [](std::span<const int> items, size_t) { return VecElemSum(items); },
+      std::plus());
   return true;
 }
 
@@ -0,0 +1,21 @@
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <mpi.h>
+
+#include <functional>
+
+#include "core/perf/include/perf_mpi.hpp"
+#include "core/registry/include/registry.hpp"
+
+int main(int argc, char **argv) {
+  boost::mpi::environment env(argc, argv);
+  boost::mpi::communicator world;
+
+  ppc::core::BenchmarkOptions options;
+  options.rank_gather = ppc::core::MpiRankGather(world);
+  options.mpi_wtime = [] { return MPI_Wtime(); };
+  options.is_root = world.rank() == 0;
+  options.all_passed = [world](bool ok) { return boost::mpi::all_reduce(world, ok, std::logical_and<bool>()); };
+  return ppc::core::RunBenchmarkCli(argc, argv, options);
+}
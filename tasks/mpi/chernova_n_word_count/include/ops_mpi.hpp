@@ -2,6 +2,7 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -9,7 +10,9 @@
 
 namespace chernova_n_word_count_mpi {
 
-std::vector<char> CleanString(const std::vector<char>& input);
+std::vector<char> CleanString(std::span<const char> input);
+// Number of space separated words, a lone "-" between spaces is not counted as a word
+int CountWords(std::span<const char> text);
 std::vector<char> GenerateWords(int k);
 std::vector<char> GenerateWordsPerf(int k);
 
@@ -22,8 +25,8 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<char> input_;
-  int space_count_{};
+  ppc::core::DataView<const char> input_;
+  int word_count_{};
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -35,10 +38,8 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<char> input_, local_input_;
+  std::vector<char> input_;
   int space_count_{};
-  int local_space_count_{};
-  int part_size_{};
   boost::mpi::communicator world_;
 };
 
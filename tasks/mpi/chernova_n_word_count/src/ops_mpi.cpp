@@ -1,14 +1,15 @@
 #include "mpi/chernova_n_word_count/include/ops_mpi.hpp"
 
-#include <boost/mpi/collectives.hpp>
-#include <boost/mpi/collectives/broadcast.hpp>
-#include <boost/mpi/collectives/reduce.hpp>
+#include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <string>
 #include <vector>
 
-std::vector<char> chernova_n_word_count_mpi::CleanString(const std::vector<char>& input) {
+#include "core/dist/include/map_reduce_mpi.hpp"
+
+std::vector<char> chernova_n_word_count_mpi::CleanString(std::span<const char> input) {
   std::string result;
   std::string str(input.begin(), input.end());
 
@@ -36,16 +37,30 @@ std::vector<char> chernova_n_word_count_mpi::CleanString(const std::vector<char>
   return {result.begin(), result.end()};
 }
 
-bool chernova_n_word_count_mpi::TestMPITaskSequential::PreProcessingImpl() {
-  input_ = std::vector<char>(task_data->inputs_count[0]);
-  space_count_ = 0;
-  auto* tmp_ptr = reinterpret_cast<char*>(task_data->inputs[0]);
-  for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
-  if (!input_.empty()) {
-    input_ = CleanString(input_);
+int chernova_n_word_count_mpi::CountWords(std::span<const char> text) {
+  int words = 0;
+  size_t i = 0;
+  while (i < text.size()) {
+    if (text[i] == ' ') {
+      i++;
+      continue;
+    }
+    size_t end = i;
+    while (end < text.size() && text[end] != ' ') {
+      end++;
+    }
+    bool is_dash = end - i == 1 && text[i] == '-' && i > 0 && end < text.size();
+    if (!is_dash) {
+      words++;
+    }
+    i = end;
   }
+  return words;
+}
+
+bool chernova_n_word_count_mpi::TestMPITaskSequential::PreProcessingImpl() {
+  input_ = task_data->InputView<char>(0);
+  word_count_ = 0;
   return true;
 }
 
@@ -54,15 +69,7 @@ bool chernova_n_word_count_mpi::TestMPITaskSequential::ValidationImpl() {
 }
 
 bool chernova_n_word_count_mpi::TestMPITaskSequential::RunImpl() {
-  if (input_.empty()) {
-    space_count_ = -1;
-  }
-  for (std::size_t i = 0; i < input_.size(); i++) {
-    char c = input_[i];
-    if (c == ' ') {
-      space_count_++;
-    }
-  }
+  word_count_ = CountWords(input_.Span());
   return true;
 }
 
@@ -70,25 +77,14 @@ bool chernova_n_word_count_mpi::TestMPITaskSequential::PostProcessingImpl() {
   if (task_data->outputs[0] == nullptr) {
     return false;
   }
-  if (input_.empty()) {
-    reinterpret_cast<int*>(task_data->outputs[0])[0] = 0;
-  } else {
-    reinterpret_cast<int*>(task_data->outputs[0])[0] = space_count_ + 1;
-  }
+  reinterpret_cast<int*>(task_data->outputs[0])[0] = word_count_;
   return true;
 }
 
 bool chernova_n_word_count_mpi::TestMPITaskParallel::PreProcessingImpl() {
   if (world_.rank() == 0) {
-    input_ = std::vector<char>(task_data->inputs_count[0]);
-    space_count_ = 0;
-    auto* tmp_ptr = reinterpret_cast<char*>(task_data->inputs[0]);
-    for (std::size_t i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
-    if (!input_.empty()) {
-      input_ = CleanString(input_);
-    }
+    auto input = task_data->InputView<char>(0);
+    input_ = input.Empty() ? std::vector<char>() : CleanString(input.Span());
     task_data->inputs_count[0] = input_.size();
   }
   return true;
@@ -102,48 +98,11 @@ bool chernova_n_word_count_mpi::TestMPITaskParallel::ValidationImpl() {
 }
 
 bool chernova_n_word_count_mpi::TestMPITaskParallel::RunImpl() {
-  unsigned long total_size = 0;
-  if (world_.rank() == 0) {
-    total_size = input_.size();
-    part_size_ = static_cast<int>(task_data->inputs_count[0] / world_.size());
-  }
-  boost::mpi::broadcast(world_, part_size_, 0);
-  boost::mpi::broadcast(world_, total_size, 0);
-  if (total_size == 0) {
-    space_count_ = -1;
-    boost::mpi::broadcast(world_, space_count_, 0);
-    return true;
-  }
-
-  unsigned long start_pos = world_.rank() * part_size_;
-  size_t actual_part_size = (start_pos + part_size_ <= total_size) ? part_size_ : (total_size - start_pos);
-
-  local_input_.resize(actual_part_size);
-
-  if (world_.rank() == 0) {
-    for (int proc = 1; proc < world_.size(); proc++) {
-      unsigned long proc_start_pos = proc * part_size_;
-      unsigned long proc_part_size =
-          (proc_start_pos + part_size_ <= total_size) ? part_size_ : (total_size - proc_start_pos);
-      if (proc_part_size > 0) {
-        world_.send(proc, 0, input_.data() + proc_start_pos, static_cast<int>(proc_part_size));
-      }
-    }
-    local_input_.assign(input_.begin(), input_.begin() + static_cast<std::ptrdiff_t>(actual_part_size));
-  } else {
-    if (actual_part_size > 0) {
-      world_.recv(0, 0, local_input_.data(), static_cast<int>(actual_part_size));
-    }
-  }
-  local_space_count_ = 0;
-  for (std::size_t i = 0; i < local_input_.size(); ++i) {
-    if (local_input_[i] == ' ') {
-      local_space_count_++;
-    }
-  }
-
-  boost::mpi::reduce(world_, local_space_count_, space_count_, std::plus<>(), 0);
-
+  // the cleaned string has single spaces between words
+  space_count_ = ppc::core::MapReduce(
+      world_, input_.data(), input_.size(), 0,
+      [](std::span<const char> items, size_t) { return static_cast<int>(std::ranges::count(items, ' ')); },
+      std::plus());
   return true;
 }
 
@@ -152,11 +111,7 @@ bool chernova_n_word_count_mpi::TestMPITaskParallel::PostProcessingImpl() {
     if (task_data->outputs[0] == nullptr) {
       return false;
     }
-    if (space_count_ == -1) {
-      reinterpret_cast<int*>(task_data->outputs[0])[0] = 0;
-    } else {
-      reinterpret_cast<int*>(task_data->outputs[0])[0] = space_count_ + 1;
-    }
+    reinterpret_cast<int*>(task_data->outputs[0])[0] = input_.empty() ? 0 : space_count_ + 1;
   }
   return true;
 }
\ No newline at end of file
@@ -0,0 +1,9 @@
+#include "core/perf/include/example_benchmark.hpp"
+#include "core/registry/include/registry.hpp"
+#include "mpi/example/include/ops_mpi.hpp"
+
+namespace {
+
+const ppc::core::TaskRegistrar kRegistrar(ppc::core::ExampleBenchmark<nesterov_a_test_task_mpi::TestTaskMPI>("mpi"));
+
+}  // namespace
@@ -1,6 +1,6 @@
 #include <gtest/gtest.h>
 
-#include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -8,18 +8,22 @@
 
 #include "boost/mpi/communicator.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_mpi.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 #include "mpi/example/include/ops_mpi.hpp"
 
 TEST(nesterov_a_test_task_mpi, test_pipeline_run) {
-  constexpr int kCount = 500;
+  // PPC_PERF_SCALE multiplies the work of the O(n^3) product for weak scaling runs
+  const auto count = static_cast<size_t>(500 * std::cbrt(ppc::util::GetPerfScale()));
+  boost::mpi::communicator world;
 
   // Create data
-  std::vector<int> in(kCount * kCount, 0);
-  std::vector<int> out(kCount * kCount, 0);
+  std::vector<int> in(count * count, 0);
+  std::vector<int> out(count * count, 0);
 
-  for (size_t i = 0; i < kCount; i++) {
-    in[(i * kCount) + i] = 1;
+  for (size_t i = 0; i < count; i++) {
+    in[(i * count) + i] = 1;
   }
 
   // Create task_data
@@ -35,20 +39,14 @@ TEST(nesterov_a_test_task_mpi, test_pipeline_run) {
   // Create Perf attributes
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
-  const auto t0 = std::chrono::high_resolution_clock::now();
-  perf_attr->current_timer = [&] {
-    auto current_time_point = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
-    return static_cast<double>(duration) * 1e-9;
-  };
+  perf_attr->rank_gather = ppc::core::MpiRankGather(world);
+  ppc::core::UseMpiWtime(*perf_attr);
 
   // Create and init perf results
   auto perf_results = std::make_shared<ppc::core::PerfResults>();
 
   auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_mpi);
   perf_analyzer->PipelineRun(perf_attr, perf_results);
-  // Create Perf analyzer
-  boost::mpi::communicator world;
   if (world.rank() == 0) {
     ppc::core::Perf::PrintPerfStatistic(perf_results);
   }
@@ -57,14 +55,16 @@ TEST(nesterov_a_test_task_mpi, test_pipeline_run) {
 }
 
 TEST(nesterov_a_test_task_mpi, test_task_run) {
-  constexpr int kCount = 500;
+  // PPC_PERF_SCALE multiplies the work of the O(n^3) product for weak scaling runs
+  const auto count = static_cast<size_t>(500 * std::cbrt(ppc::util::GetPerfScale()));
+  boost::mpi::communicator world;
 
   // Create data
-  std::vector<int> in(kCount * kCount, 0);
-  std::vector<int> out(kCount * kCount, 0);
+  std::vector<int> in(count * count, 0);
+  std::vector<int> out(count * count, 0);
 
-  for (size_t i = 0; i < kCount; i++) {
-    in[(i * kCount) + i] = 1;
+  for (size_t i = 0; i < count; i++) {
+    in[(i * count) + i] = 1;
   }
 
   // Create task_data
@@ -80,12 +80,8 @@ TEST(nesterov_a_test_task_mpi, test_task_run) {
   // Create Perf attributes
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
-  const auto t0 = std::chrono::high_resolution_clock::now();
-  perf_attr->current_timer = [&] {
-    auto current_time_point = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
-    return static_cast<double>(duration) * 1e-9;
-  };
+  perf_attr->rank_gather = ppc::core::MpiRankGather(world);
+  ppc::core::UseMpiWtime(*perf_attr);
 
   // Create and init perf results
   auto perf_results = std::make_shared<ppc::core::PerfResults>();
@@ -93,8 +89,6 @@ TEST(nesterov_a_test_task_mpi, test_task_run) {
   // Create Perf analyzer
   auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_mpi);
   perf_analyzer->TaskRun(perf_attr, perf_results);
-  // Create Perf analyzer
-  boost::mpi::communicator world;
   if (world.rank() == 0) {
     ppc::core::Perf::PrintPerfStatistic(perf_results);
   }
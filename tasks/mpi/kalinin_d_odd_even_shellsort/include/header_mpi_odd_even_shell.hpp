@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/dist/include/distribution.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kalinin_d_odd_even_shell_mpi {
@@ -14,7 +15,7 @@ class OddEvenShellMpi : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   void ExchangeAndMerge(std::vector<int>& local_vec, int neighbour);
-  void GatherResults(std::vector<int>& local_vec, int local_sz, int id);
+  void GatherResults(const std::vector<int>& local_vec, const ppc::core::Distribution& blocks);
   bool PostProcessingImpl() override;
 
   static void ShellSort(std::vector<int>& vec);
@@ -1,11 +1,10 @@
 #include <algorithm>
 #include <boost/mpi/collectives/broadcast.hpp>
-#include <boost/mpi/collectives/gather.hpp>
-#include <boost/mpi/collectives/scatter.hpp>
-#include <limits>
-#include <random>
 #include <vector>
 
+#include "core/dist/include/distribution.hpp"
+#include "core/dist/include/distribution_mpi.hpp"
+#include "core/gen/include/generators.hpp"
 #include "mpi/kalinin_d_odd_even_shellsort/include/header_mpi_odd_even_shell.hpp"
 
 namespace kalinin_d_odd_even_shell_mpi {
@@ -23,10 +22,7 @@ void OddEvenShellMpi::ShellSort(std::vector<int>& vec) {
   }
 }
 void GimmeRandVec(std::vector<int>& vec) {
-  std::random_device rd;
-  std::default_random_engine reng(rd());
-  std::uniform_int_distribution<int> dist(0, static_cast<int>(vec.size()));
-  std::ranges::generate(vec.begin(), vec.end(), [&dist, &reng] { return dist(reng); });
+  ppc::core::FillUniform<int>(vec, 0, static_cast<int>(vec.size()));
 }
 
 bool OddEvenShellMpi::PreProcessingImpl() {
@@ -65,16 +61,16 @@ bool OddEvenShellMpi::RunImpl() {
   }
 
   bool is_even = (sz % 2 == 0);
-  int local_sz = 0;
+  int total_sz = 0;
   if (id == 0) {
-    int reminder = static_cast<int>((sz - (input_.size() % sz)) % sz);
-    input_.resize(input_.size() + reminder, std::numeric_limits<int>::max());
-    local_sz = static_cast<int>(input_.size() / sz);
+    total_sz = static_cast<int>(input_.size());
   }
-  broadcast(world_, local_sz, 0);
+  broadcast(world_, total_sz, 0);
 
-  std::vector<int> local_vec(local_sz);
-  scatter(world_, input_, local_vec.data(), local_sz, 0);
+  // blocks differ by at most one element, merge-split below keeps the size of every block
+  auto blocks = ppc::core::Distribution::Block(total_sz, sz);
+  std::vector<int> local_vec(blocks->ItemCount(id));
+  ppc::core::Scatter(world_, *blocks, input_.data(), local_vec.data());
   ShellSort(local_vec);
 
   for (int i = 0; i < sz; ++i) {
@@ -97,14 +93,13 @@ bool OddEvenShellMpi::RunImpl() {
     ExchangeAndMerge(local_vec, neighbour);
   }
 
-  GatherResults(local_vec, local_sz, id);
+  GatherResults(local_vec, *blocks);
   return true;
 }
 
 void OddEvenShellMpi::ExchangeAndMerge(std::vector<int>& local_vec, int neighbour) {
   int local_sz = static_cast<int>(local_vec.size());
-  std::vector<int> received_data(local_sz);
-  std::vector<int> merged(2 * local_sz);
+  std::vector<int> received_data;
 
   if (world_.rank() < neighbour) {
     world_.send(neighbour, 0, local_vec);
@@ -114,22 +109,21 @@ void OddEvenShellMpi::ExchangeAndMerge(std::vector<int>& local_vec, int neighbou
     world_.send(neighbour, 1, local_vec);
   }
 
+  std::vector<int> merged(local_vec.size() + received_data.size());
   std::ranges::merge(local_vec.begin(), local_vec.end(), received_data.begin(), received_data.end(), merged.begin());
 
   if (world_.rank() < neighbour) {
     local_vec.assign(merged.begin(), merged.begin() + local_sz);
   } else {
-    local_vec.assign(merged.begin() + local_sz, merged.end());
+    local_vec.assign(merged.end() - local_sz, merged.end());
   }
 }
 
-void OddEvenShellMpi::GatherResults(std::vector<int>& local_vec, int local_sz, int id) {
-  if (id == 0) {
+void OddEvenShellMpi::GatherResults(const std::vector<int>& local_vec, const ppc::core::Distribution& blocks) {
+  if (world_.rank() == 0) {
     output_.resize(input_.size());
-    gather(world_, local_vec.data(), local_sz, output_, 0);
-  } else {
-    gather(world_, local_vec.data(), local_sz, 0);
   }
+  ppc::core::Gather(world_, blocks, local_vec.data(), output_.data());
 }
 
 }  // namespace kalinin_d_odd_even_shell_mpi
\ No newline at end of file
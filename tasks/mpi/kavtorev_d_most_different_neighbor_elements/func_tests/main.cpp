@@ -1,11 +1,26 @@
 #include <gtest/gtest.h>
 
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <boost/mpi/collectives/broadcast.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/serialization/string.hpp>  // NOLINT(*-include-cleaner)
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <memory>
 #include <random>
+#include <span>
+#include <string>
 #include <vector>
 
+#include "core/dataset/include/dataset.hpp"
 #include "core/task/include/task.hpp"
 #include "mpi/kavtorev_d_most_different_neighbor_elements/include/ops_mpi.hpp"
 
@@ -26,6 +41,25 @@ std::vector<int> Generator(int sz) {
 
   return ans;
 }
+
+// unique file in the working directory, which all ranks of a run share (the temp directory
+// may be node local); the root picks the name and broadcasts it
+std::string SharedTempPath(const boost::mpi::communicator& world) {
+  std::string path;
+  if (world.rank() == 0) {
+#ifdef _WIN32
+    const int pid = _getpid();
+#else
+    const int pid = getpid();
+#endif
+    const std::string test = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    path = (std::filesystem::current_path() / ("ppc_kavtorev_" + test + "_" + std::to_string(pid) + "_" +
+                                               std::to_string(std::random_device{}()) + ".bin"))
+               .string();
+  }
+  boost::mpi::broadcast(world, path, 0);
+  return path;
+}
 }  // namespace
 }  // namespace kavtorev_d_most_different_neighbor_elements_mpi
 
@@ -509,4 +543,41 @@ TEST(kavtorev_d_most_different_neighbor_elements_mpi, MostlyZerosInput_ReturnsCo
 
     ASSERT_EQ(reference_max[0], global_max[0]);
   }
-}
\ No newline at end of file
+}
+
+TEST(kavtorev_d_most_different_neighbor_elements_mpi, DatasetFileInput_EveryRankReadsItsSlice) {
+  boost::mpi::communicator world;
+  const std::string path = kavtorev_d_most_different_neighbor_elements_mpi::SharedTempPath(world);
+  std::vector<int> global_vec;
+  std::vector<int> global_max(1);
+  ppc::core::MappedDataset dataset;
+  auto task_data_mpi = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    global_vec = kavtorev_d_most_different_neighbor_elements_mpi::Generator(1003);
+    ppc::core::WriteDataset(path, std::span<const int>(global_vec), {global_vec.size()});
+    dataset = ppc::core::MappedDataset::Open(path);
+    dataset.AddInput(*task_data_mpi);
+    task_data_mpi->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_max.data()));
+    task_data_mpi->outputs_count.emplace_back(global_max.size());
+  }
+  world.barrier();
+  task_data_mpi->inputs_file = path;
+
+  kavtorev_d_most_different_neighbor_elements_mpi::MostDifferentNeighborElementsMpi test_mpi_task_parallel(
+      task_data_mpi);
+  ASSERT_EQ(test_mpi_task_parallel.ValidationImpl(), true);
+  test_mpi_task_parallel.PreProcessingImpl();
+  test_mpi_task_parallel.RunImpl();
+  test_mpi_task_parallel.PostProcessingImpl();
+  world.barrier();
+
+  if (world.rank() == 0) {
+    std::filesystem::remove(path);
+    int reference_max = 0;
+    for (size_t i = 1; i < global_vec.size(); ++i) {
+      reference_max = std::max(reference_max, std::abs(global_vec[i] - global_vec[i - 1]));
+    }
+    ASSERT_EQ(reference_max, global_max[0]);
+  }
+}
@@ -35,10 +35,8 @@ class MostDifferentNeighborElementsMpi : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> input_, local_input_;
-  std::pair<int, int> res_;
-  size_t size_;
-  size_t st_;
+  ppc::core::DataView<const int> input_;
+  int res_{};
   boost::mpi::communicator world_;
 };
 
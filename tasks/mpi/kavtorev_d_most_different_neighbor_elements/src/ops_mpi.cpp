@@ -1,15 +1,16 @@
 #include "mpi/kavtorev_d_most_different_neighbor_elements/include/ops_mpi.hpp"
 
 #include <algorithm>
-#include <boost/mpi/collectives/broadcast.hpp>
-#include <boost/mpi/collectives/reduce.hpp>
-#include <boost/mpi/operations.hpp>
 #include <climits>
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/dataset/include/dataset_mpi.hpp"
+#include "core/dist/include/map_reduce_mpi.hpp"
+
 bool kavtorev_d_most_different_neighbor_elements_mpi::MostDifferentNeighborElementsSeq::PreProcessingImpl() {
   auto input = std::vector<int>(task_data->inputs_count[0]);
   auto* tmp = reinterpret_cast<int*>(task_data->inputs[0]);
@@ -45,7 +46,10 @@ bool kavtorev_d_most_different_neighbor_elements_mpi::MostDifferentNeighborEleme
 }
 
 bool kavtorev_d_most_different_neighbor_elements_mpi::MostDifferentNeighborElementsMpi::PreProcessingImpl() {
-  res_ = {INT_MIN, -1};
+  if (world_.rank() == 0) {
+    input_ = task_data->InputView<int>(0);
+  }
+  res_ = INT_MIN;
   return true;
 }
 
@@ -57,45 +61,27 @@ bool kavtorev_d_most_different_neighbor_elements_mpi::MostDifferentNeighborEleme
 }
 
 bool kavtorev_d_most_different_neighbor_elements_mpi::MostDifferentNeighborElementsMpi::RunImpl() {
-  int delta_size = 0;
-  if (world_.rank() == 0) {
-    delta_size = static_cast<int>(task_data->inputs_count[0]) / world_.size();
-    size_ = static_cast<int>(task_data->inputs_count[0]);
-    if (task_data->inputs_count[0] % world_.size() > 0) {
-      delta_size++;
-    }
-  }
-  broadcast(world_, delta_size, 0);
-
-  if (world_.rank() == 0) {
-    input_ = std::vector<int>((world_.size() * delta_size) + 2, 0);
-    auto* tmp = reinterpret_cast<int*>(task_data->inputs[0]);
-    std::copy(tmp, tmp + task_data->inputs_count[0], input_.begin());
-    for (int proc = 1; proc < world_.size(); proc++) {
-      world_.send(proc, 0, input_.data() + (proc * delta_size), delta_size + 1);
+  // the halo element pairs the last own element with the first one of the next rank
+  ppc::core::MapReduceOptions options;
+  options.halo = 1;
+  auto kernel = [](std::span<const int> items, size_t own) {
+    int local_max = INT_MIN;
+    for (size_t i = 0; i < own && i + 1 < items.size(); ++i) {
+      local_max = std::max(local_max, std::abs(items[i + 1] - items[i]));
     }
-  }
-
-  local_input_ = std::vector<int>(delta_size + 1);
-  st_ = world_.rank() * delta_size;
-  if (world_.rank() == 0) {
-    local_input_ = std::vector<int>(input_.begin(), input_.begin() + delta_size + 1);
-  } else {
-    world_.recv(0, 0, local_input_.data(), delta_size + 1);
-  }
-
-  std::pair<int, int> local_ans = {INT_MIN, -1};
-  for (size_t i = 0; (i + st_) < size_ - 1 && i < (local_input_.size() - 1); ++i) {
-    std::pair<int, int> tmp = {abs(local_input_[i + 1] - local_input_[i]), i + st_};
-    local_ans = std::max(local_ans, tmp);
-  }
-  reduce(world_, local_ans, res_, boost::mpi::maximum<std::pair<int, int>>(), 0);
+    return local_max;
+  };
+  auto combine = [](int a, int b) { return std::max(a, b); };
+  // with a dataset file every rank reads its own slice, rank 0 only maps the file for validation
+  res_ = task_data->inputs_file.empty()
+             ? ppc::core::MapReduce(world_, input_.Data(), input_.Size(), INT_MIN, kernel, combine, options)
+             : ppc::core::MapReduceDataset<int>(world_, task_data->inputs_file, INT_MIN, kernel, combine, options);
   return true;
 }
 
 bool kavtorev_d_most_different_neighbor_elements_mpi::MostDifferentNeighborElementsMpi::PostProcessingImpl() {
   if (world_.rank() == 0) {
-    reinterpret_cast<int*>(task_data->outputs[0])[0] = res_.first;
+    reinterpret_cast<int*>(task_data->outputs[0])[0] = res_;
   }
   return true;
 }
\ No newline at end of file
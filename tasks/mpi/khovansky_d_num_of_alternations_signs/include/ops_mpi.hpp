@@ -31,7 +31,6 @@ class NumOfAlternationsSignsMpi : public ppc::core::Task {
 
  private:
   std::vector<int> input_;
-  std::vector<int> start_;
   int res_{};
   boost::mpi::communicator world_;
 };
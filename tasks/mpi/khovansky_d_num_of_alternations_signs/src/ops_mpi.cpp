@@ -1,13 +1,12 @@
 #include "mpi/khovansky_d_num_of_alternations_signs/include/ops_mpi.hpp"
 
-#include <boost/mpi/collectives.hpp>
-#include <boost/mpi/collectives/reduce.hpp>
-#include <boost/mpi/communicator.hpp>
 #include <cstddef>
-#include <cstdint>
 #include <functional>
+#include <span>
 #include <vector>
 
+#include "core/dist/include/map_reduce_mpi.hpp"
+
 bool khovansky_d_num_of_alternations_signs_mpi::NumOfAlternationsSignsSeq::PreProcessingImpl() {
   // Init value for input and output
   unsigned int input_size = task_data->inputs_count[0];
@@ -99,31 +98,21 @@ bool khovansky_d_num_of_alternations_signs_mpi::NumOfAlternationsSignsMpi::Valid
 }
 
 bool khovansky_d_num_of_alternations_signs_mpi::NumOfAlternationsSignsMpi::RunImpl() {
-  if (world_.rank() == 0) {
-    auto input_size = task_data->inputs_count[0];
-    auto start_size = input_size / world_.size();
-    auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-    input_ = std::vector<int>(in_ptr, in_ptr + input_size);
-    start_ = std::vector<int>(in_ptr, in_ptr + start_size + uint32_t(world_.size() > 1));
-
-    for (int process = 1; process < world_.size(); process++) {
-      auto local_start = process * start_size;
-      auto is_last_proc = (process == world_.size() - 1);
-      auto size = is_last_proc ? (input_size - local_start) : (start_size + 1);
-      world_.send(process, 0, std::vector<int>(in_ptr + local_start, in_ptr + local_start + size));
-    }
-  } else {
-    world_.recv(0, 0, start_);
-  }
-
-  auto process_res = 0;
-  auto start_size = start_.size();
-  for (size_t i = 0; i < start_size - 1; i++) {
-    if ((start_[i] < 0 && start_[i + 1] >= 0) || (start_[i] >= 0 && start_[i + 1] < 0)) {
-      process_res++;
-    }
-  }
-  boost::mpi::reduce(world_, process_res, res_, std::plus(), 0);
+  // the first element of the next rank closes the pair of the last own element
+  ppc::core::MapReduceOptions options;
+  options.halo = 1;
+  res_ = ppc::core::MapReduce(
+      world_, input_.data(), input_.size(), 0,
+      [](std::span<const int> items, size_t own) {
+        int process_res = 0;
+        for (size_t i = 0; i < own && i + 1 < items.size(); i++) {
+          if ((items[i] < 0 && items[i + 1] >= 0) || (items[i] >= 0 && items[i + 1] < 0)) {
+            process_res++;
+          }
+        }
+        return process_res;
+      },
+      std::plus(), options);
   return true;
 }
 
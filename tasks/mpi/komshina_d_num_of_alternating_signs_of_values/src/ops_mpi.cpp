@@ -1,11 +1,12 @@
 #include "mpi/komshina_d_num_of_alternating_signs_of_values/include/ops_mpi.hpp"
 
-#include <mpi.h>
-
-#include <cmath>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <vector>
 
+#include "core/dist/include/map_reduce_mpi.hpp"
+
 bool komshina_d_num_of_alternations_signs_mpi::TestTaskMPI::PreProcessingImpl() {
   if (world_.rank() == 0) {
     unsigned int input_size = task_data->inputs_count[0];
@@ -24,62 +25,20 @@ bool komshina_d_num_of_alternations_signs_mpi::TestTaskMPI::ValidationImpl() {
 }
 
 bool komshina_d_num_of_alternations_signs_mpi::TestTaskMPI::RunImpl() {
-  unsigned int delta = 0;
-  unsigned int remainder = 0;
-
-  if (world_.rank() == 0) {
-    const auto input_size = static_cast<std::size_t>(task_data->inputs_count[0]);
-    delta = input_size / world_.size();
-    remainder = input_size % world_.size();
-  }
-
-  MPI_Bcast(&delta, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&remainder, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
-
-  std::vector<int> local_input;
-  const auto local_size = static_cast<std::size_t>(delta) + (world_.rank() == world_.size() - 1 ? remainder : 0);
-
-  if (world_.rank() == 0) {
-    local_input.assign(input_.begin(), input_.begin() + static_cast<int>(local_size));
-    for (int proc = 1; proc < world_.size(); ++proc) {
-      const std::size_t send_count = delta + (proc == world_.size() - 1 ? remainder : 0);
-      MPI_Send(input_.data() + (proc * static_cast<int>(delta)), static_cast<int>(send_count), MPI_INT, proc, 0,
-               MPI_COMM_WORLD);
-    }
-  } else {
-    local_input.resize(local_size);
-    MPI_Recv(local_input.data(), static_cast<int>(local_size), MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-  }
-
-  int local_count = 0;
-  if (local_input.size() > 1) {
-    for (std::size_t i = 1; i < local_input.size(); ++i) {
-      if (local_input[i - 1] * local_input[i] < 0) {
-        ++local_count;
-      }
-    }
-  }
-
-  if (world_.rank() > 0) {
-    int prev_value = 0;
-    MPI_Recv(&prev_value, 1, MPI_INT, world_.rank() - 1, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-    if (!local_input.empty() && prev_value * local_input[0] < 0) {
-      ++local_count;
-    }
-  }
-
-  if (world_.rank() < world_.size() - 1) {
-    const int last_value = local_input.empty() ? 0 : local_input.back();
-    MPI_Send(&last_value, 1, MPI_INT, world_.rank() + 1, 0, MPI_COMM_WORLD);
-  }
-
-  int global_count = 0;
-  MPI_Reduce(&local_count, &global_count, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
-
-  if (world_.rank() == 0) {
-    result_ = global_count;
-  }
-
+  ppc::core::MapReduceOptions options;
+  options.halo = 1;
+  result_ = ppc::core::MapReduce(
+      world_, input_.data(), input_.size(), 0,
+      [](std::span<const int> items, size_t own) {
+        int local_count = 0;
+        for (std::size_t i = 1; i < items.size() && i <= own; ++i) {
+          if ((items[i - 1] < 0 && items[i] > 0) || (items[i - 1] > 0 && items[i] < 0)) {
+            ++local_count;
+          }
+        }
+        return local_count;
+      },
+      std::plus(), options);
   return true;
 }
 
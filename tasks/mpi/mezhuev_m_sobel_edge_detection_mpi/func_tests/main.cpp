@@ -239,3 +239,43 @@ TEST(mezhuev_m_sobel_edge_detection_mpi, test_constant_image) {
     ASSERT_TRUE(std::ranges::all_of(out.begin(), out.end(), [](uint8_t val) { return val == 0; }));
   }
 }
+
+TEST(mezhuev_m_sobel_edge_detection_mpi, test_reuse_task_for_other_sizes) {
+  boost::mpi::environment env;
+  boost::mpi::communicator world;
+
+  auto run = [&](const std::shared_ptr<mezhuev_m_sobel_edge_detection_mpi::SobelEdgeDetection>& sobel_task,
+                 std::vector<uint8_t>& in, std::vector<uint8_t>& out) {
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->inputs = {in.data()};
+    task_data->inputs_count = {static_cast<uint32_t>(in.size())};
+    task_data->outputs = {out.data()};
+    task_data->outputs_count = {static_cast<uint32_t>(out.size())};
+    sobel_task->SetData(task_data);
+    return sobel_task->ValidationImpl() && sobel_task->PreProcessingImpl() && sobel_task->RunImpl() &&
+           sobel_task->PostProcessingImpl();
+  };
+
+  auto make_task = [&world] {
+    return std::make_shared<mezhuev_m_sobel_edge_detection_mpi::SobelEdgeDetection>(
+        world, std::make_shared<ppc::core::TaskData>());
+  };
+
+  // the halo tiles are set up again when the size changes and reused when it stays
+  auto reused = make_task();
+  for (size_t width : {7, 5, 5, 7}) {
+    std::vector<uint8_t> in(width * width);
+    for (size_t i = 0; i < in.size(); i++) {
+      in[i] = static_cast<uint8_t>((i * 97) % 256);
+    }
+    std::vector<uint8_t> out(in.size(), 0);
+    std::vector<uint8_t> expected(in.size(), 0);
+    auto fresh = make_task();
+    ASSERT_TRUE(run(reused, in, out));
+    ASSERT_TRUE(run(fresh, in, expected));
+
+    if (world.rank() == 0) {
+      EXPECT_EQ(out, expected) << "width " << width;
+    }
+  }
+}
@@ -1,10 +1,13 @@
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "core/dist/include/halo_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace mezhuev_m_sobel_edge_detection_mpi {
@@ -26,6 +29,12 @@ class SobelEdgeDetection : public ppc::core::Task {
   boost::mpi::communicator& world_;
   std::vector<int> gradient_x_;
   std::vector<int> gradient_y_;
+  // tiles of the input with a one pixel halo and of the result, set up once per image size
+  // and number of ranks
+  std::unique_ptr<ppc::core::HaloExchange<uint8_t>> image_;
+  std::unique_ptr<ppc::core::HaloExchange<uint8_t>> result_;
+  size_t tiled_width_ = 0;
+  int tiled_ranks_ = 0;
 };
 
 }  // namespace mezhuev_m_sobel_edge_detection_mpi
\ No newline at end of file
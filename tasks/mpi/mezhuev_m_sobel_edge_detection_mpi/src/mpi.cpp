@@ -5,8 +5,11 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
+#include "core/dist/include/halo_mpi.hpp"
+
 namespace mezhuev_m_sobel_edge_detection_mpi {
 
 bool SobelEdgeDetection::PreProcessingImpl() {
@@ -33,6 +36,16 @@ bool SobelEdgeDetection::PreProcessingImpl() {
 
   gradient_x_.resize(data_size);
   gradient_y_.resize(data_size);
+
+  // 3x3 stencil over tiles of a grid of ranks, the persistent halo requests are reused by every Run
+  // and by the next runs on images of the same size
+  if (!image_ || width != tiled_width_ || world_.size() != tiled_ranks_) {
+    image_ = std::make_unique<ppc::core::HaloExchange<uint8_t>>(world_, height, width, 1, ppc::core::HaloLayout::kGrid);
+    result_ =
+        std::make_unique<ppc::core::HaloExchange<uint8_t>>(world_, height, width, 0, ppc::core::HaloLayout::kGrid);
+    tiled_width_ = width;
+    tiled_ranks_ = world_.size();
+  }
   return true;
 }
 
@@ -57,66 +70,65 @@ bool SobelEdgeDetection::RunImpl() {
       task_data->outputs_count.empty()) {
     return false;
   }
-  int rank = world_.rank();
-  int size = world_.size();
   auto width = static_cast<size_t>(std::sqrt(task_data->inputs_count[0]));
   auto height = width;
-  if (height < 3 || width < 3) {
+  if (height < 3 || width < 3 || !image_ || !result_) {
     return false;
   }
 
-  uint8_t* input = task_data->inputs[0];
-  uint8_t* output = task_data->outputs[0];
-
-  size_t rows_per_proc = height / size;
-  size_t extra_rows = height % size;
-  size_t start_row = (rank * rows_per_proc) + std::min(rank, static_cast<int>(extra_rows));
-  size_t end_row = ((rank + 1) * rows_per_proc) + std::min(rank + 1, static_cast<int>(extra_rows));
-
-  auto exchange_boundaries = [&](int rank, int size) {
-    if (rank > 0) {
-      world_.send(rank - 1, 0, input + (start_row * width), static_cast<int>(width));
-      world_.recv(rank - 1, 0, input + ((start_row - 1) * width), static_cast<int>(width));
-    }
-    if (rank < size - 1) {
-      world_.recv(rank + 1, 0, input + (end_row * width), static_cast<int>(width));
-      world_.send(rank + 1, 0, input + ((end_row - 1) * width), static_cast<int>(width));
-    }
-  };
-  exchange_boundaries(rank, size);
+  // the inner cells of the tile are computed while the one pixel halo is exchanged, the cells
+  // on the edge of the tile after it arrived
+  auto &image = *image_;
+  auto &result = *result_;
+  image.Scatter(task_data->inputs[0]);
+  image.Start();
 
-  auto apply_sobel = [&](size_t y, size_t x) -> uint8_t {
+  const auto rows = static_cast<ptrdiff_t>(image.Rows());
+  const auto cols = static_cast<ptrdiff_t>(image.Cols());
+  auto apply_sobel = [&](ptrdiff_t y, ptrdiff_t x) {
     static constexpr int kSobelX[3][3] = {{-1, 0, 1}, {-2, 0, 2}, {-1, 0, 1}};
     static constexpr int kSobelY[3][3] = {{1, 2, 1}, {0, 0, 0}, {-1, -2, -1}};
 
+    // pixels on the border of the image stay 0
+    const size_t global_y = image.FirstRow() + static_cast<size_t>(y);
+    const size_t global_x = image.FirstCol() + static_cast<size_t>(x);
+    if (global_y == 0 || global_y == height - 1 || global_x == 0 || global_x == width - 1) {
+      return;
+    }
     int gx = 0;
     int gy = 0;
     for (int ky = -1; ky <= 1; ++ky) {
       for (int kx = -1; kx <= 1; ++kx) {
-        uint8_t pixel = input[((y + ky) * width) + (x + kx)];
+        uint8_t pixel = image.At(y + ky, x + kx);
         gx += kSobelX[ky + 1][kx + 1] * pixel;
         gy += kSobelY[ky + 1][kx + 1] * pixel;
       }
     }
-    return static_cast<uint8_t>(std::min(std::sqrt((gx * gx) + (gy * gy)), 255.0));
+    result.At(y, x) = static_cast<uint8_t>(std::min(std::sqrt((gx * gx) + (gy * gy)), 255.0));
   };
 
-  for (size_t y = std::max(start_row, size_t(1)); y < std::min(end_row, height - 1); ++y) {
-    for (size_t x = 1; x < width - 1; ++x) {
-      output[(y * width) + x] = apply_sobel(y, x);
+  for (ptrdiff_t y = 1; y < rows - 1; ++y) {
+    for (ptrdiff_t x = 1; x < cols - 1; ++x) {
+      apply_sobel(y, x);
     }
   }
 
-  if (rank == 0) {
-    for (int i = 1; i < size; ++i) {
-      size_t ws = (i * rows_per_proc) + std::min(i, static_cast<int>(extra_rows));
-      size_t we = ((i + 1) * rows_per_proc) + std::min(i + 1, static_cast<int>(extra_rows));
-      world_.recv(i, 0, output + (ws * width), static_cast<int>((we - ws) * width));
+  image.Wait();
+  for (ptrdiff_t y = 0; y < rows; ++y) {
+    if (y == 0 || y == rows - 1) {
+      for (ptrdiff_t x = 0; x < cols; ++x) {
+        apply_sobel(y, x);
+      }
+    } else if (cols > 0) {
+      apply_sobel(y, 0);
+      if (cols > 1) {
+        apply_sobel(y, cols - 1);
+      }
     }
-  } else {
-    world_.send(0, 0, output + (start_row * width), static_cast<int>((end_row - start_row) * width));
   }
 
+  result.Gather(task_data->outputs[0]);
+
   return true;
 }
 
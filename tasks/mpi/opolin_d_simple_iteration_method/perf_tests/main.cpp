@@ -77,6 +77,7 @@ TEST(opolin_d_simple_iteration_method_mpi, test_pipeline_run) {
   test_task_mpi->PostProcessing();
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
+  perf_attr->profile_phases = true;
   const auto t0 = std::chrono::high_resolution_clock::now();
   perf_attr->current_timer = [&] {
     auto current_time_point = std::chrono::high_resolution_clock::now();
@@ -1,12 +1,497 @@
 #include <gtest/gtest.h>
 
+#include <mpi.h>
+
+#include <array>
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// MPI calls recorded by the interposition layer below
+enum CommOp : uint8_t {
+  kSend,
+  kSsend,
+  kIsend,
+  kRecv,
+  kIrecv,
+  kMrecv,
+  kSendrecv,
+  kProbe,
+  kIprobe,
+  kMprobe,
+  kWait,
+  kWaitall,
+  kWaitany,
+  kWaitsome,
+  kTest,
+  kTestall,
+  kTestany,
+  kTestsome,
+  kSendInit,
+  kRecvInit,
+  kStart,
+  kStartall,
+  kBarrier,
+  kBcast,
+  kReduce,
+  kAllreduce,
+  kScan,
+  kGather,
+  kGatherv,
+  kScatter,
+  kScatterv,
+  kAllgather,
+  kAllgatherv,
+  kAlltoall,
+  kAlltoallv,
+  kIbarrier,
+  kIbcast,
+  kIreduce,
+  kIallreduce,
+  kIscan,
+  kIgather,
+  kIgatherv,
+  kIscatter,
+  kIscatterv,
+  kIallgather,
+  kIallgatherv,
+  kIalltoall,
+  kIalltoallv,
+  kNumOps,
+};
+
+constexpr std::array<const char*, kNumOps> kOpNames = {
+    "Send",        "Ssend",       "Isend",       "Recv",        "Irecv",       "Mrecv",       "Sendrecv",
+    "Probe",       "Iprobe",      "Mprobe",      "Wait",        "Waitall",     "Waitany",     "Waitsome",
+    "Test",        "Testall",     "Testany",     "Testsome",    "Send_init",   "Recv_init",   "Start",
+    "Startall",    "Barrier",     "Bcast",       "Reduce",      "Allreduce",   "Scan",        "Gather",
+    "Gatherv",     "Scatter",     "Scatterv",    "Allgather",   "Allgatherv",  "Alltoall",    "Alltoallv",
+    "Ibarrier",    "Ibcast",      "Ireduce",     "Iallreduce",  "Iscan",       "Igather",     "Igatherv",
+    "Iscatter",    "Iscatterv",   "Iallgather",  "Iallgatherv", "Ialltoall",   "Ialltoallv"};
+
+struct CommProfile {
+  bool recording = false;
+  std::array<uint64_t, kNumOps> calls{};
+  // payload passed in the send buffer of this rank
+  std::array<uint64_t, kNumOps> bytes{};
+  std::array<double, kNumOps> time{};
+  // point-to-point messages and bytes by destination rank in MPI_COMM_WORLD
+  std::vector<uint64_t> messages_to;
+  std::vector<uint64_t> bytes_to;
+
+  void Reset(int world_size) {
+    calls.fill(0);
+    bytes.fill(0);
+    time.fill(0.0);
+    messages_to.assign(world_size, 0);
+    bytes_to.assign(world_size, 0);
+  }
+};
+
+CommProfile comm_profile;
+
+// message of a persistent send, recorded each time the request is started
+struct PersistentSend {
+  int dest;
+  MPI_Comm comm;
+  uint64_t bytes;
+};
+
+std::map<MPI_Request, PersistentSend> persistent_sends;
+
+uint64_t PayloadBytes(int count, MPI_Datatype type) {
+  int size = 0;
+  PMPI_Type_size(type, &size);
+  return static_cast<uint64_t>(count) * static_cast<uint64_t>(size);
+}
+
+uint64_t PayloadBytes(const int* counts, int num, MPI_Datatype type) {
+  uint64_t bytes = 0;
+  for (int i = 0; i < num; i++) {
+    bytes += PayloadBytes(counts[i], type);
+  }
+  return bytes;
+}
+
+int CommSize(MPI_Comm comm) {
+  int size = 0;
+  PMPI_Comm_size(comm, &size);
+  return size;
+}
+
+bool IsRoot(int root, MPI_Comm comm) {
+  int rank = 0;
+  PMPI_Comm_rank(comm, &rank);
+  return rank == root;
+}
+
+// times one MPI call and adds it to the profile of the running test
+class CommRecord {
+ public:
+  CommRecord(CommOp op, uint64_t bytes) : op_(op), begin_(comm_profile.recording ? PMPI_Wtime() : 0.0) {
+    if (comm_profile.recording) {
+      comm_profile.calls[op_]++;
+      comm_profile.bytes[op_] += bytes;
+    }
+  }
+  CommRecord(const CommRecord&) = delete;
+  CommRecord& operator=(const CommRecord&) = delete;
+  ~CommRecord() {
+    if (comm_profile.recording) {
+      comm_profile.time[op_] += PMPI_Wtime() - begin_;
+    }
+  }
+
+ private:
+  CommOp op_;
+  double begin_;
+};
+
+void RecordMessage(int dest, MPI_Comm comm, uint64_t bytes) {
+  if (!comm_profile.recording || dest < 0) {
+    return;
+  }
+  int world_rank = dest;
+  if (comm != MPI_COMM_WORLD) {
+    MPI_Group group = MPI_GROUP_NULL;
+    MPI_Group world_group = MPI_GROUP_NULL;
+    PMPI_Comm_group(comm, &group);
+    PMPI_Comm_group(MPI_COMM_WORLD, &world_group);
+    PMPI_Group_translate_ranks(group, 1, &dest, world_group, &world_rank);
+    PMPI_Group_free(&group);
+    PMPI_Group_free(&world_group);
+  }
+  if (world_rank >= 0 && static_cast<size_t>(world_rank) < comm_profile.messages_to.size()) {
+    comm_profile.messages_to[world_rank]++;
+    comm_profile.bytes_to[world_rank] += bytes;
+  }
+}
+
+// payload of the persistent sends among the started requests
+uint64_t StartedBytes(int count, const MPI_Request* requests) {
+  uint64_t bytes = 0;
+  for (int i = 0; i < count; i++) {
+    auto it = persistent_sends.find(requests[i]);
+    if (it != persistent_sends.end()) {
+      RecordMessage(it->second.dest, it->second.comm, it->second.bytes);
+      bytes += it->second.bytes;
+    }
+  }
+  return bytes;
+}
+
+}  // namespace
+
+// PMPI interposition: the test executable defines these MPI functions, so calls from the tasks
+// and from Boost.MPI land here and are forwarded to the PMPI_ entry points of the library.
+// MS-MPI declares them with another calling convention, the profiler is off there.
+#ifndef _WIN32
+extern "C" {
+
+int MPI_Send(const void* buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm) {
+  const auto bytes = PayloadBytes(count, datatype);
+  RecordMessage(dest, comm, bytes);
+  CommRecord record(kSend, bytes);
+  return PMPI_Send(buf, count, datatype, dest, tag, comm);
+}
+
+int MPI_Ssend(const void* buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm) {
+  const auto bytes = PayloadBytes(count, datatype);
+  RecordMessage(dest, comm, bytes);
+  CommRecord record(kSsend, bytes);
+  return PMPI_Ssend(buf, count, datatype, dest, tag, comm);
+}
+
+int MPI_Isend(const void* buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm,
+              MPI_Request* request) {
+  const auto bytes = PayloadBytes(count, datatype);
+  RecordMessage(dest, comm, bytes);
+  CommRecord record(kIsend, bytes);
+  return PMPI_Isend(buf, count, datatype, dest, tag, comm, request);
+}
+
+int MPI_Recv(void* buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status* status) {
+  CommRecord record(kRecv, 0);
+  return PMPI_Recv(buf, count, datatype, source, tag, comm, status);
+}
+
+int MPI_Irecv(void* buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm,
+              MPI_Request* request) {
+  CommRecord record(kIrecv, 0);
+  return PMPI_Irecv(buf, count, datatype, source, tag, comm, request);
+}
+
+int MPI_Mrecv(void* buf, int count, MPI_Datatype type, MPI_Message* message, MPI_Status* status) {
+  CommRecord record(kMrecv, 0);
+  return PMPI_Mrecv(buf, count, type, message, status);
+}
+
+int MPI_Sendrecv(const void* sendbuf, int sendcount, MPI_Datatype sendtype, int dest, int sendtag, void* recvbuf,
+                 int recvcount, MPI_Datatype recvtype, int source, int recvtag, MPI_Comm comm, MPI_Status* status) {
+  const auto bytes = PayloadBytes(sendcount, sendtype);
+  RecordMessage(dest, comm, bytes);
+  CommRecord record(kSendrecv, bytes);
+  return PMPI_Sendrecv(sendbuf, sendcount, sendtype, dest, sendtag, recvbuf, recvcount, recvtype, source, recvtag,
+                       comm, status);
+}
+
+int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status* status) {
+  CommRecord record(kProbe, 0);
+  return PMPI_Probe(source, tag, comm, status);
+}
+
+int MPI_Iprobe(int source, int tag, MPI_Comm comm, int* flag, MPI_Status* status) {
+  CommRecord record(kIprobe, 0);
+  return PMPI_Iprobe(source, tag, comm, flag, status);
+}
+
+int MPI_Mprobe(int source, int tag, MPI_Comm comm, MPI_Message* message, MPI_Status* status) {
+  CommRecord record(kMprobe, 0);
+  return PMPI_Mprobe(source, tag, comm, message, status);
+}
+
+int MPI_Wait(MPI_Request* request, MPI_Status* status) {
+  CommRecord record(kWait, 0);
+  return PMPI_Wait(request, status);
+}
+
+int MPI_Waitall(int count, MPI_Request array_of_requests[], MPI_Status array_of_statuses[]) {
+  CommRecord record(kWaitall, 0);
+  return PMPI_Waitall(count, array_of_requests, array_of_statuses);
+}
+
+int MPI_Waitany(int count, MPI_Request array_of_requests[], int* index, MPI_Status* status) {
+  CommRecord record(kWaitany, 0);
+  return PMPI_Waitany(count, array_of_requests, index, status);
+}
+
+int MPI_Waitsome(int incount, MPI_Request array_of_requests[], int* outcount, int array_of_indices[],
+                 MPI_Status array_of_statuses[]) {
+  CommRecord record(kWaitsome, 0);
+  return PMPI_Waitsome(incount, array_of_requests, outcount, array_of_indices, array_of_statuses);
+}
+
+int MPI_Test(MPI_Request* request, int* flag, MPI_Status* status) {
+  CommRecord record(kTest, 0);
+  return PMPI_Test(request, flag, status);
+}
+
+int MPI_Testall(int count, MPI_Request array_of_requests[], int* flag, MPI_Status array_of_statuses[]) {
+  CommRecord record(kTestall, 0);
+  return PMPI_Testall(count, array_of_requests, flag, array_of_statuses);
+}
+
+int MPI_Testany(int count, MPI_Request array_of_requests[], int* index, int* flag, MPI_Status* status) {
+  CommRecord record(kTestany, 0);
+  return PMPI_Testany(count, array_of_requests, index, flag, status);
+}
+
+int MPI_Testsome(int incount, MPI_Request array_of_requests[], int* outcount, int array_of_indices[],
+                 MPI_Status array_of_statuses[]) {
+  CommRecord record(kTestsome, 0);
+  return PMPI_Testsome(incount, array_of_requests, outcount, array_of_indices, array_of_statuses);
+}
+
+int MPI_Send_init(const void* buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm,
+                  MPI_Request* request) {
+  CommRecord record(kSendInit, 0);
+  const int result = PMPI_Send_init(buf, count, datatype, dest, tag, comm, request);
+  // only tracked while a test is profiled, sends set up before that are not counted when started
+  if (comm_profile.recording && result == MPI_SUCCESS) {
+    persistent_sends[*request] = {dest, comm, PayloadBytes(count, datatype)};
+  }
+  return result;
+}
+
+int MPI_Recv_init(void* buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm,
+                  MPI_Request* request) {
+  CommRecord record(kRecvInit, 0);
+  return PMPI_Recv_init(buf, count, datatype, source, tag, comm, request);
+}
+
+int MPI_Start(MPI_Request* request) {
+  CommRecord record(kStart, StartedBytes(1, request));
+  return PMPI_Start(request);
+}
+
+int MPI_Startall(int count, MPI_Request array_of_requests[]) {
+  CommRecord record(kStartall, StartedBytes(count, array_of_requests));
+  return PMPI_Startall(count, array_of_requests);
+}
+
+int MPI_Request_free(MPI_Request* request) {
+  persistent_sends.erase(*request);
+  return PMPI_Request_free(request);
+}
+
+int MPI_Barrier(MPI_Comm comm) {
+  CommRecord record(kBarrier, 0);
+  return PMPI_Barrier(comm);
+}
+
+int MPI_Bcast(void* buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm) {
+  CommRecord record(kBcast, IsRoot(root, comm) ? PayloadBytes(count, datatype) : 0);
+  return PMPI_Bcast(buffer, count, datatype, root, comm);
+}
+
+int MPI_Reduce(const void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root,
+               MPI_Comm comm) {
+  CommRecord record(kReduce, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(count, datatype));
+  return PMPI_Reduce(sendbuf, recvbuf, count, datatype, op, root, comm);
+}
+
+int MPI_Allreduce(const void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
+  CommRecord record(kAllreduce, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(count, datatype));
+  return PMPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
+int MPI_Scan(const void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
+  CommRecord record(kScan, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(count, datatype));
+  return PMPI_Scan(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
+int MPI_Gather(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+               MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  CommRecord record(kGather, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcount, sendtype));
+  return PMPI_Gather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm);
+}
+
+int MPI_Gatherv(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, const int recvcounts[],
+                const int displs[], MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  CommRecord record(kGatherv, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcount, sendtype));
+  return PMPI_Gatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, root, comm);
+}
+
+int MPI_Scatter(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  CommRecord record(kScatter, IsRoot(root, comm) ? PayloadBytes(sendcount, sendtype) * CommSize(comm) : 0);
+  return PMPI_Scatter(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm);
+}
+
+int MPI_Scatterv(const void* sendbuf, const int sendcounts[], const int displs[], MPI_Datatype sendtype, void* recvbuf,
+                 int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  CommRecord record(kScatterv, IsRoot(root, comm) ? PayloadBytes(sendcounts, CommSize(comm), sendtype) : 0);
+  return PMPI_Scatterv(sendbuf, sendcounts, displs, sendtype, recvbuf, recvcount, recvtype, root, comm);
+}
+
+int MPI_Allgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                  MPI_Datatype recvtype, MPI_Comm comm) {
+  CommRecord record(kAllgather, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcount, sendtype));
+  return PMPI_Allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm);
+}
+
+int MPI_Allgatherv(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, const int recvcounts[],
+                   const int displs[], MPI_Datatype recvtype, MPI_Comm comm) {
+  CommRecord record(kAllgatherv, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcount, sendtype));
+  return PMPI_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm);
+}
+
+int MPI_Alltoall(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                 MPI_Datatype recvtype, MPI_Comm comm) {
+  CommRecord record(kAlltoall, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcount, sendtype) * CommSize(comm));
+  return PMPI_Alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm);
+}
+
+int MPI_Alltoallv(const void* sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype,
+                  void* recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm) {
+  CommRecord record(kAlltoallv, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcounts, CommSize(comm), sendtype));
+  return PMPI_Alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm);
+}
+
+// nonblocking collectives count their payload when they are started, the time of the call
+// only covers the start, waiting for them shows up under Wait/Test
+int MPI_Ibarrier(MPI_Comm comm, MPI_Request* request) {
+  CommRecord record(kIbarrier, 0);
+  return PMPI_Ibarrier(comm, request);
+}
+
+int MPI_Ibcast(void* buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm, MPI_Request* request) {
+  CommRecord record(kIbcast, IsRoot(root, comm) ? PayloadBytes(count, datatype) : 0);
+  return PMPI_Ibcast(buffer, count, datatype, root, comm, request);
+}
+
+int MPI_Ireduce(const void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root,
+                MPI_Comm comm, MPI_Request* request) {
+  CommRecord record(kIreduce, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(count, datatype));
+  return PMPI_Ireduce(sendbuf, recvbuf, count, datatype, op, root, comm, request);
+}
+
+int MPI_Iallreduce(const void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm,
+                   MPI_Request* request) {
+  CommRecord record(kIallreduce, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(count, datatype));
+  return PMPI_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, request);
+}
+
+int MPI_Iscan(const void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm,
+              MPI_Request* request) {
+  CommRecord record(kIscan, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(count, datatype));
+  return PMPI_Iscan(sendbuf, recvbuf, count, datatype, op, comm, request);
+}
+
+int MPI_Igather(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request* request) {
+  CommRecord record(kIgather, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcount, sendtype));
+  return PMPI_Igather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, request);
+}
+
+int MPI_Igatherv(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, const int recvcounts[],
+                 const int displs[], MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request* request) {
+  CommRecord record(kIgatherv, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcount, sendtype));
+  return PMPI_Igatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, root, comm, request);
+}
+
+int MPI_Iscatter(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                 MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request* request) {
+  CommRecord record(kIscatter, IsRoot(root, comm) ? PayloadBytes(sendcount, sendtype) * CommSize(comm) : 0);
+  return PMPI_Iscatter(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm, request);
+}
+
+int MPI_Iscatterv(const void* sendbuf, const int sendcounts[], const int displs[], MPI_Datatype sendtype,
+                  void* recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request* request) {
+  CommRecord record(kIscatterv, IsRoot(root, comm) ? PayloadBytes(sendcounts, CommSize(comm), sendtype) : 0);
+  return PMPI_Iscatterv(sendbuf, sendcounts, displs, sendtype, recvbuf, recvcount, recvtype, root, comm, request);
+}
+
+int MPI_Iallgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                   MPI_Datatype recvtype, MPI_Comm comm, MPI_Request* request) {
+  CommRecord record(kIallgather, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcount, sendtype));
+  return PMPI_Iallgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request);
+}
+
+int MPI_Iallgatherv(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, const int recvcounts[],
+                    const int displs[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request* request) {
+  CommRecord record(kIallgatherv, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcount, sendtype));
+  return PMPI_Iallgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, request);
+}
+
+int MPI_Ialltoall(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                  MPI_Datatype recvtype, MPI_Comm comm, MPI_Request* request) {
+  CommRecord record(kIalltoall, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcount, sendtype) * CommSize(comm));
+  return PMPI_Ialltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, request);
+}
+
+int MPI_Ialltoallv(const void* sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype,
+                   void* recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm,
+                   MPI_Request* request) {
+  CommRecord record(kIalltoallv, sendbuf == MPI_IN_PLACE ? 0 : PayloadBytes(sendcounts, CommSize(comm), sendtype));
+  return PMPI_Ialltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls, recvtype, comm,
+                         request);
+}
+
+}  // extern "C"
+#endif
 
 class UnreadMessagesDetector : public ::testing::EmptyTestEventListener {
  public:
@@ -28,6 +513,103 @@ class UnreadMessagesDetector : public ::testing::EmptyTestEventListener {
   boost::mpi::communicator com_;
 };
 
+// Prints, per test and per rank, the time spent in MPI calls and the bytes they moved, and the
+// point-to-point communication matrix (enabled by PPC_COMM_PROFILE=1). Only the calls wrapped
+// above are seen: buffered and ready sends (Bsend/Rsend), Exscan, Reduce_scatter, neighbourhood
+// collectives, one-sided and MPI-IO calls are not counted
+
+class CommunicationProfiler : public ::testing::EmptyTestEventListener {
+ public:
+  CommunicationProfiler(boost::mpi::communicator com) : com_(std::move(com)) {}
+
+  void OnTestStart(const ::testing::TestInfo& /*test_info*/) override {
+    PMPI_Barrier(com_);
+    comm_profile.Reset(com_.size());
+    start_ = PMPI_Wtime();
+    comm_profile.recording = true;
+  }
+
+  void OnTestEnd(const ::testing::TestInfo& test_info) override {
+    comm_profile.recording = false;
+    // wall time, then time, calls and bytes of every op, then messages and bytes to every rank
+    std::vector<double> local = {PMPI_Wtime() - start_};
+    local.insert(local.end(), comm_profile.time.begin(), comm_profile.time.end());
+    local.insert(local.end(), comm_profile.calls.begin(), comm_profile.calls.end());
+    local.insert(local.end(), comm_profile.bytes.begin(), comm_profile.bytes.end());
+    local.insert(local.end(), comm_profile.messages_to.begin(), comm_profile.messages_to.end());
+    local.insert(local.end(), comm_profile.bytes_to.begin(), comm_profile.bytes_to.end());
+    const int count = static_cast<int>(local.size());
+    std::vector<double> all(com_.rank() == 0 ? local.size() * com_.size() : 0);
+    PMPI_Gather(local.data(), count, MPI_DOUBLE, all.data(), count, MPI_DOUBLE, 0, com_);
+    if (com_.rank() == 0) {
+      Print(test_info, all, local.size());
+    }
+  }
+
+ private:
+  void Print(const ::testing::TestInfo& test_info, const std::vector<double>& all, size_t per_rank) const {
+    const auto size = static_cast<size_t>(com_.size());
+    printf("[ COMM     ] %s.%s: %zu processes\n", test_info.test_suite_name(), test_info.name(), size);
+    std::vector<double> received_messages(size, 0.0);
+    std::vector<double> received_bytes(size, 0.0);
+    for (size_t rank = 0; rank < size; rank++) {
+      const double* messages_to = &all[(rank * per_rank) + 1 + (3 * kNumOps)];
+      for (size_t to = 0; to < size; to++) {
+        received_messages[to] += messages_to[to];
+        received_bytes[to] += messages_to[size + to];
+      }
+    }
+    for (size_t rank = 0; rank < size; rank++) {
+      const double* values = &all[rank * per_rank];
+      const double* time = values + 1;
+      const double* calls = time + kNumOps;
+      const double* bytes = calls + kNumOps;
+      const double* messages_to = bytes + kNumOps;
+      double mpi_time = 0.0;
+      double sent_messages = 0.0;
+      double sent_bytes = 0.0;
+      for (size_t op = 0; op < kNumOps; op++) {
+        mpi_time += time[op];
+      }
+      for (size_t to = 0; to < size; to++) {
+        sent_messages += messages_to[to];
+        sent_bytes += messages_to[size + to];
+      }
+      printf("[ COMM     ] rank %zu: wall %.6f s, mpi %.6f s (%.1f%%), sent %.0f msgs/%.0f B, recv %.0f msgs/%.0f B\n",
+             rank, values[0], mpi_time, values[0] > 0.0 ? 100.0 * mpi_time / values[0] : 0.0, sent_messages,
+             sent_bytes, received_messages[rank], received_bytes[rank]);
+      for (size_t op = 0; op < kNumOps; op++) {
+        if (calls[op] > 0.0) {
+          printf("[ COMM     ]   %-11s %8.0f calls %.6f s %12.0f B\n", kOpNames[op], calls[op], time[op], bytes[op]);
+        }
+      }
+    }
+    bool any_message = false;
+    for (auto messages : received_messages) {
+      any_message = any_message || messages > 0.0;
+    }
+    if (!any_message) {
+      return;
+    }
+    printf("[ COMM     ] point-to-point bytes, row sends to column:\n[ COMM     ] %6s", "");
+    for (size_t to = 0; to < size; to++) {
+      printf(" %12zu", to);
+    }
+    printf("\n");
+    for (size_t rank = 0; rank < size; rank++) {
+      const double* bytes_to = &all[(rank * per_rank) + 1 + (3 * kNumOps) + size];
+      printf("[ COMM     ] %6zu", rank);
+      for (size_t to = 0; to < size; to++) {
+        printf(" %12.0f", bytes_to[to]);
+      }
+      printf("\n");
+    }
+  }
+
+  boost::mpi::communicator com_;
+  double start_ = 0.0;
+};
+
 class WorkerTestFailurePrinter : public ::testing::EmptyTestEventListener {
  public:
   WorkerTestFailurePrinter(std::shared_ptr<::testing::TestEventListener> base, boost::mpi::communicator com)
@@ -68,6 +650,12 @@ int main(int argc, char** argv) {
     listeners.Append(new WorkerTestFailurePrinter(std::shared_ptr<::testing::TestEventListener>(listener), world));
   }
   listeners.Append(new UnreadMessagesDetector(world));
+#ifndef _WIN32
+  // appended last: its OnTestEnd runs first, before the barriers of the other listeners
+  if (ppc::util::GetEnv("PPC_COMM_PROFILE") == "1") {
+    listeners.Append(new CommunicationProfiler(world));
+  }
+#endif
 
   return RUN_ALL_TESTS();
 }
@@ -3,22 +3,17 @@
 #include <boost/mpi/communicator.hpp>
 #include <cstdint>
 #include <memory>
-#include <random>
 #include <vector>
 
+#include "core/gen/include/generators.hpp"
 #include "core/task/include/task.hpp"
 #include "mpi/shishkarev_a_gaussian_method_horizontal_strip_pattern/include/ops_mpi.hpp"
 
 namespace shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi {
 
 std::vector<double> GetRandomMatrix(int sz) {
-  std::random_device dev;
-  std::mt19937 gen(dev());
-  std::uniform_real_distribution<double> dis(-1000, 1000);
   std::vector<double> mat(sz);
-  for (int i = 0; i < sz; ++i) {
-    mat[i] = dis(gen);
-  }
+  ppc::core::FillUniform<double>(mat, -1000, 1000);
   return mat;
 }
 
@@ -5,9 +5,9 @@
 #include <cmath>
 #include <cstdint>
 #include <memory>
-#include <random>
 #include <vector>
 
+#include "core/gen/include/generators.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 #include "mpi/shishkarev_a_gaussian_method_horizontal_strip_pattern/include/ops_mpi.hpp"
@@ -15,13 +15,8 @@
 namespace shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi {
 
 std::vector<double> GetRandomMatrix(int sz) {
-  std::random_device dev;
-  std::mt19937 gen(dev());
-  std::uniform_real_distribution<double> dis(-1000, 1000);
   std::vector<double> matrix(sz);
-  for (int i = 0; i < sz; ++i) {
-    matrix[i] = dis(gen);
-  }
+  ppc::core::FillUniform<double>(matrix, -1000, 1000);
   return matrix;
 }
 
@@ -74,6 +69,7 @@ TEST(shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi, test_pipeline_ru
 
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
+  perf_attr->profile_phases = true;
   const boost::mpi::timer current_timer;
   perf_attr->current_timer = [&] { return current_timer.elapsed(); };
 
@@ -9,6 +9,9 @@
 #include <cstring>
 #include <vector>
 
+#include "core/dist/include/distribution.hpp"
+#include "core/dist/include/distribution_mpi.hpp"
+
 using namespace std::chrono_literals;
 
 int shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::MatrixRank(Matrix matrix, std::vector<double> a) {
@@ -159,54 +162,9 @@ void shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::BroadcastMatrixS
   broadcast(world, rows, 0);
 }
 
-std::vector<int> shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::ComputeRowDistribution(
-    boost::mpi::communicator& world, int rows) {
-  std::vector<int> row_num(world.size());
-  int delta = rows / world.size();
-  int remainder = rows % world.size();
-  if (world.rank() < remainder) {
-    delta++;
-  }
-  boost::mpi::gather(world, delta, row_num, 0);
-  return row_num;
-}
-
-void shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::DistributeMatrix(boost::mpi::communicator& world,
-                                                                                 const std::vector<int>& row_num,
-                                                                                 int delta, int cols,
-                                                                                 std::vector<double>& matrix) {
-  if (world.rank() == 0) {
-    std::vector<double> send_matrix((delta * cols));
-    for (int proc = 1; proc < world.size(); ++proc) {
-      for (int i = 0; i < row_num[proc]; ++i) {
-        for (int j = 0; j < cols; ++j) {
-          send_matrix[(i * cols) + j] = matrix[((proc + (world.size() * i)) * cols) + j];
-        }
-      }
-      world.send(proc, 0, send_matrix.data(), row_num[proc] * cols);
-    }
-  }
-}
-
-void shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::ReceiveMatrix(boost::mpi::communicator& world,
-                                                                              int delta, int cols,
-                                                                              std::vector<double>& local_matrix,
-                                                                              std::vector<double>& matrix) {
-  local_matrix.resize(delta * cols);
-  if (world.rank() == 0) {
-    for (int i = 0; i < delta; ++i) {
-      for (int j = 0; j < cols; ++j) {
-        local_matrix[(i * cols) + j] = matrix[(i * cols * world.size()) + j];
-      }
-    }
-  } else {
-    world.recv(0, 0, local_matrix.data(), delta * cols);
-  }
-}
-
 void shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::ForwardElimination(boost::mpi::communicator& world,
                                                                                    Matrix matrix, Vector& vector) {
-  std::vector<double> pivot{static_cast<double>(matrix.cols)};
+  std::vector<double> pivot(matrix.cols);
   int r = 0;
   for (int i = 0; i < matrix.rows - 1; ++i) {
     if (i == vector.row[r]) {
@@ -253,19 +211,22 @@ void shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::BackSubstitution
 
 bool shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::MPIGaussHorizontalParallel::RunImpl() {
   BroadcastMatrixSize(world_, rows_, cols_);
-  std::vector<int> row_num = ComputeRowDistribution(world_, rows_);
-  DistributeMatrix(world_, row_num, row_num[world_.rank()], cols_, matrix_);
-  ReceiveMatrix(world_, row_num[world_.rank()], cols_, local_matrix_, matrix_);
-
-  std::vector<double> row(row_num[world_.rank()]);
-  for (int i = 0; i < static_cast<int>(row.size()); ++i) {
-    row[i] = world_.rank() + world_.size() * i;
+  // rows are dealt cyclically so every rank keeps work until the last pivots, the root sends
+  // them straight from matrix_ without packing
+  auto rows = ppc::core::Distribution::Cyclic(rows_, world_.size(), cols_);
+  const int delta = static_cast<int>(rows->ItemCount(world_.rank()));
+  local_matrix_.resize(rows->Counts()[world_.rank()]);
+  ppc::core::Scatter(world_, *rows, matrix_.data(), local_matrix_.data());
+
+  std::vector<double> row(delta);
+  for (int i = 0; i < delta; ++i) {
+    row[i] = static_cast<double>(rows->GlobalIndex(world_.rank(), i));
   }
 
   Matrix matrix;
   matrix.cols = cols_;
   matrix.rows = rows_;
-  matrix.delta = row_num[world_.rank()];
+  matrix.delta = delta;
 
   Vector vector;
   vector.local_matrix = local_matrix_;
@@ -33,8 +33,8 @@ class CharFreqCounterPar : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<signed char> input_, local_input_;
-  int result_{}, local_result_{};
+  std::vector<signed char> input_;
+  int result_{};
   char target_{};
   boost::mpi::communicator world_;
 };
@@ -2,12 +2,13 @@
 
 #include <algorithm>
 #include <boost/mpi/collectives/broadcast.hpp>
-#include <boost/mpi/collectives/reduce.hpp>
-#include <boost/mpi/collectives/scatter.hpp>
-#include <boost/mpi/collectives/scatterv.hpp>
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <vector>
+
+#include "core/dist/include/map_reduce_mpi.hpp"
+
 //  Sequential
 
 bool strakhov_a_char_freq_counter_mpi::CharFreqCounterSeq::PreProcessingImpl() {
@@ -49,7 +50,6 @@ bool strakhov_a_char_freq_counter_mpi::CharFreqCounterPar::PreProcessingImpl() {
   }
 
   result_ = 0;
-  local_result_ = 0;
   return true;
 }
 
@@ -61,42 +61,13 @@ bool strakhov_a_char_freq_counter_mpi::CharFreqCounterPar::ValidationImpl() {
 }
 
 bool strakhov_a_char_freq_counter_mpi::CharFreqCounterPar::RunImpl() {
-  int local_input_size = 0;
-  std::vector<int> send_counts;
-  std::vector<int> displacements{};
-  int rank = world_.rank();
-
   broadcast(world_, target_, 0);
-
-  if (rank == 0) {
-    int input_length = static_cast<int>(task_data->inputs_count[0]);
-    int world_size = world_.size();
-    int segment = input_length / world_size;
-    int excess = input_length % world_size;
-
-    send_counts.resize(world_size);
-    for (int i = 0; i < world_size; ++i) {
-      send_counts[i] = segment + (i < excess ? 1 : 0);
-    }
-
-    displacements.resize(world_size);
-    if (!(displacements.empty())) {
-      displacements[0] = 0;
-      for (int i = 1; i < world_size; ++i) {
-        displacements[i] = displacements[i - 1] + send_counts[i - 1];
-      }
-    }
-  } else {
-    input_.clear();
-  }
-
-  boost::mpi::scatter(world_, send_counts, local_input_size, 0);
-  local_input_.resize(local_input_size);
-  boost::mpi::scatterv(world_, input_.data(), send_counts, displacements, local_input_.data(), local_input_size, 0);
-  local_result_ = static_cast<int>(std::count(local_input_.begin(), local_input_.end(), target_));
-
-  boost::mpi::reduce(world_, local_result_, result_, std::plus<>(), 0);
-
+  result_ = ppc::core::MapReduce(
+      world_, input_.data(), input_.size(), 0,
+      [this](std::span<const signed char> items, size_t) {
+        return static_cast<int>(std::count(items.begin(), items.end(), target_));
+      },
+      std::plus());
   return true;
 }
 
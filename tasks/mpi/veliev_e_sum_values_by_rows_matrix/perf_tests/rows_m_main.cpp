@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_mpi.hpp"
 #include "core/task/include/task.hpp"
 #include "mpi/veliev_e_sum_values_by_rows_matrix/include/rows_m_header.hpp"
 TEST(veliev_e_sum_values_by_rows_matrix_mpi, test_pipeline_run) {
@@ -32,6 +33,8 @@ TEST(veliev_e_sum_values_by_rows_matrix_mpi, test_pipeline_run) {
   // Create Perf attributes
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
+  perf_attr->profile_phases = true;
+  perf_attr->rank_gather = ppc::core::MpiRankGather(world);
   const auto t0 = std::chrono::high_resolution_clock::now();
   perf_attr->current_timer = [&] {
     auto current_time_point = std::chrono::high_resolution_clock::now();
@@ -79,6 +82,7 @@ TEST(veliev_e_sum_values_by_rows_matrix_mpi, test_task_run) {
   // Create Perf attributes
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
+  perf_attr->rank_gather = ppc::core::MpiRankGather(world);
   const auto t0 = std::chrono::high_resolution_clock::now();
   perf_attr->current_timer = [&] {
     auto current_time_point = std::chrono::high_resolution_clock::now();
@@ -1,12 +1,12 @@
 #include <algorithm>
 #include <boost/mpi/collectives/broadcast.hpp>
-#include <boost/mpi/collectives/gather.hpp>
-#include <boost/mpi/collectives/scatter.hpp>
 #include <cstring>
 #include <numeric>
-#include <random>
 #include <vector>
 
+#include "core/dist/include/distribution.hpp"
+#include "core/dist/include/distribution_mpi.hpp"
+#include "core/gen/include/generators.hpp"
 #include "mpi/veliev_e_sum_values_by_rows_matrix/include/rows_m_header.hpp"
 namespace veliev_e_sum_values_by_rows_matrix_mpi {
 
@@ -21,10 +21,7 @@ void SeqProcForChecking(std::vector<int>& vec, int rows_size, std::vector<int>&
 }
 
 void GetRndMatrix(std::vector<int>& vec) {
-  std::random_device rd;
-  std::default_random_engine reng(rd());
-  std::uniform_int_distribution<int> dist(0, static_cast<int>(vec.size()) - 1);
-  std::ranges::generate(vec, [&dist, &reng] { return dist(reng); });
+  ppc::core::FillUniform<int>(vec, 0, static_cast<int>(vec.size()) - 1);
 }
 
 bool SumValuesByRowsMatrixMpi::PreProcessingImpl() {
@@ -45,15 +42,8 @@ bool SumValuesByRowsMatrixMpi::PreProcessingImpl() {
 }
 
 bool SumValuesByRowsMatrixMpi::RunImpl() {
-  int myid = world_.rank();
-  int world_size = world_.size();
-  int original_rows_total = rows_total_;
-  int row_sz = 0;
-  int rows_for_each = 0;
-  int remainder = 0;
-
   // for 1 proc run
-  if (world_size == 1) {
+  if (world_.size() == 1) {
     output_.resize(rows_total_);
     for (int i = 0; i < rows_total_; ++i) {
       output_[i] = std::accumulate(input_.begin() + i * cols_total_, input_.begin() + (i + 1) * cols_total_, 0);
@@ -61,38 +51,23 @@ bool SumValuesByRowsMatrixMpi::RunImpl() {
     return true;
   }
 
-  if (world_.rank() == 0) {
-    original_rows_total = rows_total_;
-    rows_for_each = rows_total_ / world_size;
-    remainder = rows_total_ % world_size;
-    row_sz = cols_total_;
-    if (remainder != 0) {
-      rows_total_ += (world_size - remainder);
-      input_.resize(rows_total_ * row_sz, 0);
-      rows_for_each = rows_total_ / world_size;
-    }
-  }
-  broadcast(world_, row_sz, 0);
-  broadcast(world_, rows_for_each, 0);
-
-  std::vector<int> loc_vec(row_sz * rows_for_each);
-  scatter(world_, myid == 0 ? input_.data() : nullptr, loc_vec.data(), row_sz * rows_for_each, 0);
-  std::vector<int> local_sums(rows_for_each, 0);
+  broadcast(world_, rows_total_, 0);
+  broadcast(world_, cols_total_, 0);
 
-  for (int i = 0; i < rows_for_each; ++i) {
-    local_sums[i] = std::accumulate(loc_vec.begin() + i * row_sz, loc_vec.begin() + (i + 1) * row_sz, 0);
-  }
-
-  if (world_.rank() == 0) {
-    output_.resize(rows_total_);
-  }
+  // contiguous blocks of whole rows, the remainder goes to the first ranks instead of padding rows
+  auto rows = ppc::core::Distribution::Block(rows_total_, world_.size(), cols_total_);
+  auto sums = ppc::core::Distribution::Block(rows_total_, world_.size());
+  const auto local_rows = static_cast<int>(rows->ItemCount(world_.rank()));
 
-  gather(world_, local_sums.data(), rows_for_each, output_.data(), 0);
+  std::vector<int> loc_vec(rows->Counts()[world_.rank()]);
+  ppc::core::Scatter(world_, *rows, input_.data(), loc_vec.data());
 
-  if (world_.rank() == 0) {
-    output_.resize(original_rows_total);
+  std::vector<int> local_sums(local_rows, 0);
+  for (int i = 0; i < local_rows; ++i) {
+    local_sums[i] = std::accumulate(loc_vec.begin() + i * cols_total_, loc_vec.begin() + (i + 1) * cols_total_, 0);
   }
 
+  ppc::core::Gather(world_, *sums, local_sums.data(), output_.data());
   return true;
 }
 
@@ -18,6 +18,8 @@ class TestTaskOpenMP : public ppc::core::Task {
  private:
   std::vector<int> input_, output_;
   int rc_size_{};
+  // cpu of every thread under PPC_AFFINITY, empty if threads are not pinned
+  std::vector<int> affinity_plan_;
 };
 
 }  // namespace nesterov_a_test_task_omp
\ No newline at end of file
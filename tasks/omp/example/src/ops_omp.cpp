@@ -1,9 +1,13 @@
 #include "omp/example/include/ops_omp.hpp"
 
+#include <omp.h>
+
 #include <cmath>
 #include <cstddef>
 #include <vector>
 
+#include "core/util/include/util.hpp"
+
 bool nesterov_a_test_task_omp::TestTaskOpenMP::PreProcessingImpl() {
   // Init value for input and output
   unsigned int input_size = task_data->inputs_count[0];
@@ -14,6 +18,8 @@ bool nesterov_a_test_task_omp::TestTaskOpenMP::PreProcessingImpl() {
   output_ = std::vector<int>(output_size, 0);
 
   rc_size_ = static_cast<int>(std::sqrt(input_size));
+  affinity_plan_ =
+      ppc::util::PlanAffinity(ppc::util::GetCpuTopology(), omp_get_max_threads(), ppc::util::GetPPCAffinity());
   return true;
 }
 
@@ -23,8 +29,11 @@ bool nesterov_a_test_task_omp::TestTaskOpenMP::ValidationImpl() {
 }
 
 bool nesterov_a_test_task_omp::TestTaskOpenMP::RunImpl() {
+  // thread 0 is the caller, it gets its mask back after the region
+  const ppc::util::ScopedAffinity caller_affinity;
 #pragma omp parallel default(none)
   {
+    ppc::util::PinCurrentThread(affinity_plan_, omp_get_thread_num());
 #pragma omp critical
     {
       // Multiply matrices
@@ -1,5 +1,7 @@
 #pragma once
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -7,7 +9,7 @@
 
 namespace konstantinov_i_sum_of_vector_elements_seq {
 
-int VecElemSum(const std::vector<int>& vec);
+int VecElemSum(std::span<const int> vec);
 
 class SumVecElemSequential : public ppc::core::Task {
  public:
@@ -18,7 +20,9 @@ class SumVecElemSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> input_;
+  // rows are summed in place through TaskData views
+  size_t rows_{};
+  size_t columns_{};
   int result_{};
 };
 }  // namespace konstantinov_i_sum_of_vector_elements_seq
\ No newline at end of file
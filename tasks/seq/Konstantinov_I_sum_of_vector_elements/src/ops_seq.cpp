@@ -1,9 +1,10 @@
 #include "seq/Konstantinov_I_sum_of_vector_elements/include/ops_seq.hpp"
 
 #include <cmath>
-#include <vector>
+#include <cstddef>
+#include <span>
 
-int konstantinov_i_sum_of_vector_elements_seq::VecElemSum(const std::vector<int>& vec) {
+int konstantinov_i_sum_of_vector_elements_seq::VecElemSum(std::span<const int> vec) {
   int result = 0;
   for (int elem : vec) {
     result += elem;
@@ -12,18 +13,8 @@ int konstantinov_i_sum_of_vector_elements_seq::VecElemSum(const std::vector<int>
 }
 
 bool konstantinov_i_sum_of_vector_elements_seq::SumVecElemSequential::PreProcessingImpl() {
-  int rows = static_cast<int>(task_data->inputs_count[0]);
-  int columns = static_cast<int>(task_data->inputs_count[1]);
-
-  input_ = std::vector<int>(rows * columns);
-
-  for (int i = 0; i < rows; i++) {
-    auto* el = reinterpret_cast<int*>(task_data->inputs[i]);
-    for (int j = 0; j < columns; j++) {
-      input_[(i * columns) + j] = el[j];
-    }
-  }
-
+  rows_ = task_data->inputs_count[0];
+  columns_ = task_data->inputs_count[1];
   return true;
 }
 
@@ -33,7 +24,10 @@ bool konstantinov_i_sum_of_vector_elements_seq::SumVecElemSequential::Validation
 }
 
 bool konstantinov_i_sum_of_vector_elements_seq::SumVecElemSequential::RunImpl() {
-  result_ = VecElemSum(input_);
+  result_ = 0;
+  for (size_t i = 0; i < rows_; i++) {
+    result_ += VecElemSum(task_data->InputView<int>(i, 1, columns_).Row(0));
+  }
   return true;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -7,7 +8,8 @@
 
 namespace chernova_n_word_count_seq {
 
-std::vector<char> CleanString(const std::vector<char>& input);
+// Number of space separated words, a lone "-" between spaces is not counted as a word
+int CountWords(std::span<const char> text);
 std::vector<char> GenerateWords(int k);
 std::vector<char> GenerateWordsPerf(int k);
 
@@ -20,8 +22,8 @@ class TestTaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<char> input_;
-  int spaceCount_{};
+  ppc::core::DataView<const char> input_;
+  int wordCount_{};
 };
 
 }  // namespace chernova_n_word_count_seq
\ No newline at end of file
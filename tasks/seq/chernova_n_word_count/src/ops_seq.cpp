@@ -1,44 +1,33 @@
 #include "seq/chernova_n_word_count/include/ops_seq.hpp"
 
-#include <string>
-#include <vector>
-
-std::vector<char> chernova_n_word_count_seq::CleanString(const std::vector<char>& input) {
-  std::string result;
-  std::string str(input.begin(), input.end());
-
-  std::string::size_type pos = 0;
-  while ((pos = str.find("  ", pos)) != std::string::npos) {
-    str.erase(pos, 1);
-  }
-
-  pos = 0;
-  while ((pos = str.find(" - ", pos)) != std::string::npos) {
-    str.erase(pos, 2);
-  }
-
-  pos = 0;
-  if (str[pos] == ' ') {
-    str.erase(pos, 1);
-  }
-
-  pos = str.size() - 1;
-  if (str[pos] == ' ') {
-    str.erase(pos, 1);
+#include <cstddef>
+#include <span>
+
+int chernova_n_word_count_seq::CountWords(std::span<const char> text) {
+  int words = 0;
+  size_t i = 0;
+  while (i < text.size()) {
+    if (text[i] == ' ') {
+      i++;
+      continue;
+    }
+    size_t end = i;
+    while (end < text.size() && text[end] != ' ') {
+      end++;
+    }
+    bool is_dash = end - i == 1 && text[i] == '-' && i > 0 && end < text.size();
+    if (!is_dash) {
+      words++;
+    }
+    i = end;
   }
-
-  result.assign(str.begin(), str.end());
-  return {result.begin(), result.end()};
+  return words;
 }
 
 bool chernova_n_word_count_seq::TestTaskSequential::PreProcessingImpl() {
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<char*>(task_data->inputs[0]);
-  input_ = std::vector<char>(in_ptr, in_ptr + input_size);
-
-  input_ = CleanString(input_);
-  spaceCount_ = 0;
-
+  // words are counted in the caller's buffer, no cleaned copy is made
+  input_ = task_data->InputView<char>(0);
+  wordCount_ = 0;
   return true;
 }
 
@@ -47,15 +36,7 @@ bool chernova_n_word_count_seq::TestTaskSequential::ValidationImpl() {
 }
 
 bool chernova_n_word_count_seq::TestTaskSequential::RunImpl() {
-  if (input_.empty()) {
-    spaceCount_ = -1;
-  } else {
-    for (char c : input_) {
-      if (c == ' ') {
-        spaceCount_++;
-      }
-    }
-  }
+  wordCount_ = CountWords(input_.Span());
   return true;
 }
 
@@ -63,10 +44,6 @@ bool chernova_n_word_count_seq::TestTaskSequential::PostProcessingImpl() {
   if (task_data->outputs[0] == nullptr) {
     return false;
   }
-  if (input_.empty()) {
-    reinterpret_cast<int*>(task_data->outputs[0])[0] = 0;
-  } else {
-    reinterpret_cast<int*>(task_data->outputs[0])[0] = spaceCount_ + 1;
-  }
+  reinterpret_cast<int*>(task_data->outputs[0])[0] = wordCount_;
   return true;
-}
\ No newline at end of file
+}
@@ -0,0 +1,10 @@
+#include "core/perf/include/example_benchmark.hpp"
+#include "core/registry/include/registry.hpp"
+#include "seq/example/include/ops_seq.hpp"
+
+namespace {
+
+const ppc::core::TaskRegistrar kRegistrar(
+    ppc::core::ExampleBenchmark<nesterov_a_test_task_seq::TestTaskSequential>("seq"));
+
+}  // namespace
@@ -1,7 +1,7 @@
 #include <algorithm>
-#include <random>
 #include <vector>
 
+#include "core/gen/include/generators.hpp"
 #include "seq/kalinin_d_odd_even_shellsort/include/header_seq_odd_even_shell.hpp"
 namespace kalinin_d_odd_even_shell_seq {
 
@@ -42,9 +42,6 @@ bool OddEvenShellSeq::PostProcessingImpl() {
 }
 
 void GimmeRandVec(std::vector<int>& vec) {
-  std::random_device rd;
-  std::default_random_engine reng(rd());
-  std::uniform_int_distribution<int> dist(0, static_cast<int>(vec.size()));
-  std::ranges::generate(vec.begin(), vec.end(), [&dist, &reng] { return dist(reng); });
+  ppc::core::FillUniform<int>(vec, 0, static_cast<int>(vec.size()));
 }
 }  // namespace kalinin_d_odd_even_shell_seq
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "core/registry/include/registry.hpp"
+#include "core/task/include/task.hpp"
+#include "seq/kavtorev_d_radix_double_sort/include/ops_seq.hpp"
+
+namespace {
+
+// size is the count of doubles to sort, inputs are the count and the values
+const ppc::core::TaskRegistrar kRegistrar({
+    .name = "kavtorev_d_radix_double_sort",
+    .backend = "seq",
+    .description = "radix sort of uniform doubles",
+    .default_size = 10000000,
+    .input_on_root_only = false,
+    .create =
+        [](ppc::core::TaskDataPtr task_data) {
+          return std::make_shared<kavtorev_d_radix_double_sort::RadixSortSequential>(std::move(task_data));
+        },
+    .generate =
+        [](ppc::core::BenchmarkCase &bench_case, size_t size) {
+          auto &task_data = *bench_case.task_data;
+          bench_case.arena.AddInput<int>(task_data, 1)[0] = static_cast<int>(size);
+          auto in = bench_case.arena.AddInput<double>(task_data, size);
+          std::ranges::fill(bench_case.arena.AddOutput<double>(task_data, size), 0.0);
+          std::mt19937 gen(static_cast<uint32_t>(size));
+          std::uniform_real_distribution<double> dist(-1e9, 1e9);
+          std::ranges::generate(in, [&] { return dist(gen); });
+        },
+    .verify =
+        [](const ppc::core::BenchmarkCase &bench_case, size_t size) {
+          auto in = bench_case.task_data->InputView<double>(1);
+          std::vector<double> expected(in.begin(), in.end());
+          std::ranges::sort(expected);
+          return std::ranges::equal(expected, bench_case.task_data->OutputView<double>(0));
+        },
+});
+
+}  // namespace
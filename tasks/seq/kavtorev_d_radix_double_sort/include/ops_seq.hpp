@@ -3,9 +3,10 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <span>
 #include <utility>
-#include <vector>
 
+#include "core/mem/include/arena.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kavtorev_d_radix_double_sort {
@@ -19,11 +20,14 @@ class RadixSortSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<double> data_;
+  // data, keys and radix scratch are kept in the arena and reused by repeated runs
+  enum Slot : uint8_t { kData, kKeys, kTemp };
+  ppc::core::BufferArena arena_;
+  std::span<double> data_;
   int n_ = 0;
 
-  static void RadixSortDoubles(std::vector<double>& data);
-  static void RadixSortUint64(std::vector<uint64_t>& keys);
+  void RadixSortDoubles(std::span<double> data);
+  static void RadixSortUint64(std::span<uint64_t>& keys, std::span<uint64_t>& temp);
 };
 
 }  // namespace kavtorev_d_radix_double_sort
\ No newline at end of file
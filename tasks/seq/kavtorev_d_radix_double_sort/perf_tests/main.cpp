@@ -45,6 +45,7 @@ TEST(kavtorev_d_radix_double_sort_seq, test_pipeline_run) {
 
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 5;
+  perf_attr->use_hw_counters = true;
   const auto t0 = std::chrono::high_resolution_clock::now();
   perf_attr->current_timer = [&] {
     auto current_time_point = std::chrono::high_resolution_clock::now();
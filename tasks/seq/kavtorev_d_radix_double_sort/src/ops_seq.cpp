@@ -5,12 +5,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <vector>
+#include <span>
+#include <utility>
 
 using namespace kavtorev_d_radix_double_sort;
 
 bool RadixSortSequential::PreProcessingImpl() {
-  data_.resize(n_);
+  data_ = arena_.Acquire<double>(kData, n_);
   auto* arr = reinterpret_cast<double*>(task_data->inputs[1]);
   std::copy(arr, arr + n_, data_.begin());
 
@@ -35,13 +36,14 @@ bool RadixSortSequential::RunImpl() {
 
 bool RadixSortSequential::PostProcessingImpl() {
   auto* out = reinterpret_cast<double*>(task_data->outputs[0]);
-  std::ranges::copy(data_.begin(), data_.end(), out);
+  std::ranges::copy(data_, out);
   return true;
 }
 
-void RadixSortSequential::RadixSortDoubles(std::vector<double>& data) {
+void RadixSortSequential::RadixSortDoubles(std::span<double> data) {
   size_t n = data.size();
-  std::vector<uint64_t> keys(n);
+  auto keys = arena_.Acquire<uint64_t>(kKeys, n);
+  auto temp = arena_.Acquire<uint64_t>(kTemp, n);
   for (size_t i = 0; i < n; ++i) {
     uint64_t u = 0;
     std::memcpy(&u, &data[i], sizeof(double));
@@ -53,7 +55,7 @@ void RadixSortSequential::RadixSortDoubles(std::vector<double>& data) {
     keys[i] = u;
   }
 
-  RadixSortUint64(keys);
+  RadixSortUint64(keys, temp);
 
   for (size_t i = 0; i < n; ++i) {
     uint64_t u = keys[i];
@@ -66,10 +68,9 @@ void RadixSortSequential::RadixSortDoubles(std::vector<double>& data) {
   }
 }
 
-void RadixSortSequential::RadixSortUint64(std::vector<uint64_t>& keys) {
+void RadixSortSequential::RadixSortUint64(std::span<uint64_t>& keys, std::span<uint64_t>& temp) {
   const int bits = 64;
   const int radix = 256;
-  std::vector<uint64_t> temp(keys.size());
 
   for (int shift = 0; shift < bits; shift += 8) {
     size_t count[radix + 1] = {0};
@@ -84,6 +85,6 @@ void RadixSortSequential::RadixSortUint64(std::vector<uint64_t>& keys) {
       uint8_t byte = (keys[i] >> shift) & 0xFF;
       temp[count[byte]++] = keys[i];
     }
-    keys.swap(temp);
+    std::swap(keys, temp);
   }
 }
\ No newline at end of file
@@ -42,6 +42,9 @@ bool khokhlov_a_multi_integration_monte_karlo_seq::MonteCarloSeq::RunImpl() {
   std::uniform_real_distribution<> dis(0.0, 1.0);
   result_ = 0.0;
   for (unsigned int i = 0; i < N_; i++) {
+    if (i % 4096 == 0 && StopRequested()) {
+      return false;
+    }
     std::vector<double> x(dimension_);
     for (unsigned int j = 0; j < dimension_; j++) {
       x[j] = lower_bound_[j] + (upper_bound_[j] - lower_bound_[j]) * dis(gen);
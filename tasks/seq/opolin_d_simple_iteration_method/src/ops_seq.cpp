@@ -65,6 +65,9 @@ bool opolin_d_simple_iteration_method_seq::TestTaskSequential::RunImpl() {
   // simple iteration method
   int iteration = 0;
   while (iteration < max_iter_) {
+    if (StopRequested()) {
+      return false;
+    }
     for (size_t i = 0; i < n_; ++i) {
       double sum = d_[i];
       for (size_t j = 0; j < n_; ++j) {
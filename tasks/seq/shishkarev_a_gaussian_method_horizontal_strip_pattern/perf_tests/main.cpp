@@ -3,22 +3,17 @@
 #include <chrono>
 #include <cstdint>
 #include <memory>
-#include <random>
 #include <vector>
 
+#include "core/gen/include/generators.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/shishkarev_a_gaussian_method_horizontal_strip_pattern/include/ops_seq.hpp"
 
 namespace {
 std::vector<double> GetRandomMatrix(int sz) {
-  std::random_device dev;
-  std::mt19937 gen(dev());
-  std::uniform_real_distribution<double> dis(-1000, 1000);
   std::vector<double> matrix(sz);
-  for (int i = 0; i < sz; ++i) {
-    matrix[i] = dis(gen);
-  }
+  ppc::core::FillUniform<double>(matrix, -1000, 1000);
   return matrix;
 }
 }  // namespace
@@ -44,6 +39,7 @@ TEST(shishkarev_a_gaussian_method_horizontal_strip_pattern_seq, test_pipeline_ru
 
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
+  perf_attr->profile_phases = true;
   const auto t0 = std::chrono::high_resolution_clock::now();
   perf_attr->current_timer = [&] {
     auto current_time_point = std::chrono::high_resolution_clock::now();
@@ -2,7 +2,6 @@
 
 #include <cstdint>
 #include <utility>
-#include <vector>
 
 #include "core/task/include/task.hpp"
 
@@ -18,8 +17,9 @@ class ContrastTaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<uint8_t> input_;
-  std::vector<uint8_t> output_;
+  // the image is read from and written to the caller's buffers
+  ppc::core::DataView<const uint8_t> input_;
+  ppc::core::DataView<uint8_t> output_;
   int width_{}, height_{};
 
   void IncreaseContrast();
@@ -5,16 +5,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
-#include <vector>
 
 bool shuravina_o_contrast::ContrastTaskSequential::PreProcessingImpl() {
-  auto *in_ptr = reinterpret_cast<uint8_t *>(task_data->inputs[0]);
-  if (in_ptr == nullptr) {
+  if (task_data->inputs[0] == nullptr) {
     throw std::runtime_error("Input pointer is null");
   }
-  input_ = std::vector<uint8_t>(in_ptr, in_ptr + task_data->inputs_count[0]);
-
-  output_ = std::vector<uint8_t>(task_data->outputs_count[0], 0);
+  input_ = task_data->InputView<uint8_t>(0);
+  output_ = task_data->OutputView<uint8_t>(0);
 
   const int size = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
   width_ = height_ = size;
@@ -26,15 +23,14 @@ bool shuravina_o_contrast::ContrastTaskSequential::ValidationImpl() {
 }
 
 void shuravina_o_contrast::ContrastTaskSequential::IncreaseContrast() {
-  const uint8_t min_val = *std::ranges::min_element(input_);
-  const uint8_t max_val = *std::ranges::max_element(input_);
+  const auto [min_val, max_val] = std::ranges::minmax(input_.Span());
 
   if (min_val == max_val) {
-    std::ranges::copy(input_.begin(), input_.end(), output_.begin());
+    std::ranges::copy(input_, output_.begin());
     return;
   }
 
-  for (size_t i = 0; i < input_.size(); ++i) {
+  for (size_t i = 0; i < input_.Size(); ++i) {
     output_[i] = static_cast<uint8_t>((input_[i] - min_val) * 255 / (max_val - min_val));
   }
 }
@@ -44,7 +40,4 @@ bool shuravina_o_contrast::ContrastTaskSequential::RunImpl() {
   return true;
 }
 
-bool shuravina_o_contrast::ContrastTaskSequential::PostProcessingImpl() {
-  std::ranges::copy(output_.begin(), output_.end(), reinterpret_cast<uint8_t *>(task_data->outputs[0]));
-  return true;
-}
\ No newline at end of file
+bool shuravina_o_contrast::ContrastTaskSequential::PostProcessingImpl() { return true; }
\ No newline at end of file
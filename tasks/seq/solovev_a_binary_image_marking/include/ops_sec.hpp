@@ -1,6 +1,7 @@
 #pragma once
 
 #include <queue>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -15,11 +16,11 @@ struct Point {
 using Matrix = std::vector<int>;
 using Directions = std::vector<Point>;
 
-void Bfs(int i, int j, int label, Matrix& labels_tmp, const Matrix& data_tmp, int m_tmp, int n_tmp,
+void Bfs(int i, int j, int label, Matrix& labels_tmp, std::span<const int> data_tmp, int m_tmp, int n_tmp,
          const Directions& directions);
-void ProcessNeighbor(std::queue<Point>& q, int new_x, int new_y, Matrix& labels_tmp, const Matrix& data_tmp, int label,
-                     int n_tmp);
-bool ShouldProcess(int i, int j, const Matrix& data_tmp, const Matrix& labels_tmp, int n_tmp);
+void ProcessNeighbor(std::queue<Point>& q, int new_x, int new_y, Matrix& labels_tmp, std::span<const int> data_tmp,
+                     int label, int n_tmp);
+bool ShouldProcess(int i, int j, std::span<const int> data_tmp, const Matrix& labels_tmp, int n_tmp);
 bool IsValid(int x, int y, int m_tmp, int n_tmp);
 
 class TestTaskSequential : public ppc::core::Task {
@@ -31,7 +32,8 @@ class TestTaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> data_;
+  // binary image of the caller, it is not copied
+  ppc::core::DataView<const int> data_;
   std::vector<int> labels_;
   int m_, n_;
 };
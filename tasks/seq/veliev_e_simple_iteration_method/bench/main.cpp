@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+
+#include "core/registry/include/registry.hpp"
+#include "core/task/include/task.hpp"
+#include "seq/veliev_e_simple_iteration_method/include/seq_header_iter.hpp"
+
+namespace {
+
+// size is the count of unknowns, the matrix is diagonally dominant and the solution is all ones
+const ppc::core::TaskRegistrar kRegistrar({
+    .name = "veliev_e_simple_iteration_method",
+    .backend = "seq",
+    .description = "simple iteration method for a dense diagonally dominant system",
+    .default_size = 1000,
+    .input_on_root_only = false,
+    .create =
+        [](ppc::core::TaskDataPtr task_data) {
+          return std::make_shared<veliev_e_simple_iteration_method_seq::VelievSlaeIterSeq>(std::move(task_data));
+        },
+    .generate =
+        [](ppc::core::BenchmarkCase &bench_case, size_t size) {
+          auto &task_data = *bench_case.task_data;
+          auto matrix = bench_case.arena.AddInput<double>(task_data, size * size);
+          task_data.inputs_count.back() = size;
+          auto rhs = bench_case.arena.AddInput<double>(task_data, size);
+          std::ranges::fill(bench_case.arena.AddOutput<double>(task_data, size), 0.0);
+          std::mt19937 gen(static_cast<uint32_t>(size));
+          std::uniform_real_distribution<double> dist(-1.0, 1.0);
+          for (size_t i = 0; i < size; i++) {
+            double row_sum = 0.0;
+            for (size_t j = 0; j < size; j++) {
+              matrix[(i * size) + j] = i == j ? 0.0 : dist(gen);
+              row_sum += std::abs(matrix[(i * size) + j]);
+            }
+            matrix[(i * size) + i] = 2.0 * row_sum + 1.0;
+            rhs[i] = 0.0;
+            for (size_t j = 0; j < size; j++) {
+              rhs[i] += matrix[(i * size) + j];
+            }
+          }
+        },
+    .verify =
+        [](const ppc::core::BenchmarkCase &bench_case, size_t size) {
+          auto solution = bench_case.task_data->OutputView<double>(0);
+          return std::ranges::all_of(solution, [](double x) { return std::abs(x - 1.0) < 1e-4; });
+        },
+});
+
+}  // namespace
@@ -1,8 +1,10 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -117,4 +119,41 @@ TEST(veliev_e_simple_iteration_method_seq, veliev_slae_4x4) {
   for (int i = 0; i < input_size; ++i) {
     EXPECT_NEAR(x[i], expected_solution[i], 1e-6);
   }
-}
\ No newline at end of file
+}
+
+TEST(veliev_e_simple_iteration_method_seq, veliev_slae_batch) {
+  const int input_size = 2;
+  const int batch_size = 64;
+
+  // every system has the solution {i, -i}, the last one is not diagonally dominant
+  std::vector<std::vector<double>> matrices(batch_size, std::vector<double>{4, 1, 1, 3});
+  matrices.back() = {1, 2, 2, 1};
+  std::vector<std::vector<double>> rhs(batch_size);
+  std::vector<std::vector<double>> solutions(batch_size, std::vector<double>(input_size, 0.0));
+  std::vector<std::shared_ptr<ppc::core::TaskData>> batch;
+  for (int i = 0; i < batch_size; ++i) {
+    rhs[i] = {3.0 * i, -2.0 * i};
+    auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+    task_data_seq->inputs.push_back(reinterpret_cast<uint8_t *>(matrices[i].data()));
+    task_data_seq->inputs_count.push_back(input_size);
+    task_data_seq->inputs.push_back(reinterpret_cast<uint8_t *>(rhs[i].data()));
+    task_data_seq->inputs_count.push_back(input_size);
+    task_data_seq->outputs.push_back(reinterpret_cast<uint8_t *>(solutions[i].data()));
+    task_data_seq->outputs_count.push_back(input_size);
+    batch.push_back(task_data_seq);
+  }
+
+  auto results = ppc::core::Task::RunBatch(
+      [](ppc::core::TaskDataPtr task_data) {
+        return std::make_shared<veliev_e_simple_iteration_method_seq::VelievSlaeIterSeq>(std::move(task_data));
+      },
+      batch, 4);
+
+  ASSERT_EQ(results.size(), static_cast<size_t>(batch_size));
+  EXPECT_FALSE(results.back());
+  for (int i = 0; i + 1 < batch_size; ++i) {
+    ASSERT_TRUE(results[i]);
+    EXPECT_NEAR(solutions[i][0], i, 1e-5);
+    EXPECT_NEAR(solutions[i][1], -i, 1e-5);
+  }
+}
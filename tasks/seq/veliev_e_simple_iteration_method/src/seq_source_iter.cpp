@@ -85,7 +85,7 @@ bool VelievSlaeIterSeq::RunImpl() {
     }
     solution_vector_ = next_solution;
     ++iteration;
-    if (iteration > 10000) {
+    if (iteration > 10000 || StopRequested()) {
       return false;
     }
   }
@@ -1,9 +1,9 @@
 #include <algorithm>
 #include <cstring>
 #include <numeric>
-#include <random>
 #include <vector>
 
+#include "core/gen/include/generators.hpp"
 #include "seq/veliev_e_sum_values_by_rows_matrix/include/seq_rows_m_header.hpp"
 namespace veliev_e_sum_values_by_rows_matrix_seq {
 
@@ -18,10 +18,7 @@ void SeqProcForChecking(std::vector<int>& vec, int rows_size, std::vector<int>&
 }
 
 void GetRndMatrix(std::vector<int>& vec) {
-  std::random_device rd;
-  std::default_random_engine reng(rd());
-  std::uniform_int_distribution<int> dist(0, static_cast<int>(vec.size()) - 1);
-  std::ranges::generate(vec, [&dist, &reng] { return dist(reng); });
+  ppc::core::FillUniform<int>(vec, 0, static_cast<int>(vec.size()) - 1);
 }
 
 bool SumValuesByRowsMatrixSeq::PreProcessingImpl() {
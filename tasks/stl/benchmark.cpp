@@ -0,0 +1,3 @@
+#include "core/registry/include/registry.hpp"
+
+int main(int argc, char **argv) { return ppc::core::RunBenchmarkCli(argc, argv); }
@@ -1,6 +1,6 @@
 #include <gtest/gtest.h>
 
-#include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -8,17 +8,19 @@
 
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 #include "stl/example/include/ops_stl.hpp"
 
 TEST(nesterov_a_test_task_stl, test_pipeline_run) {
-  constexpr int kCount = 700;
+  // PPC_PERF_SCALE multiplies the work of the O(n^3) product for weak scaling runs
+  const auto count = static_cast<size_t>(700 * std::cbrt(ppc::util::GetPerfScale()));
 
   // Create data
-  std::vector<int> in(kCount * kCount, 0);
-  std::vector<int> out(kCount * kCount, 0);
+  std::vector<int> in(count * count, 0);
+  std::vector<int> out(count * count, 0);
 
-  for (size_t i = 0; i < kCount; i++) {
-    in[(i * kCount) + i] = 1;
+  for (size_t i = 0; i < count; i++) {
+    in[(i * count) + i] = 1;
   }
 
   // Create task_data
@@ -34,12 +36,7 @@ TEST(nesterov_a_test_task_stl, test_pipeline_run) {
   // Create Perf attributes
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
-  const auto t0 = std::chrono::high_resolution_clock::now();
-  perf_attr->current_timer = [&] {
-    auto current_time_point = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
-    return static_cast<double>(duration) * 1e-9;
-  };
+  perf_attr->timer = ppc::core::TimerKind::kSteady;
 
   // Create and init perf results
   auto perf_results = std::make_shared<ppc::core::PerfResults>();
@@ -52,14 +49,15 @@ TEST(nesterov_a_test_task_stl, test_pipeline_run) {
 }
 
 TEST(nesterov_a_test_task_stl, test_task_run) {
-  constexpr int kCount = 700;
+  // PPC_PERF_SCALE multiplies the work of the O(n^3) product for weak scaling runs
+  const auto count = static_cast<size_t>(700 * std::cbrt(ppc::util::GetPerfScale()));
 
   // Create data
-  std::vector<int> in(kCount * kCount, 0);
-  std::vector<int> out(kCount * kCount, 0);
+  std::vector<int> in(count * count, 0);
+  std::vector<int> out(count * count, 0);
 
-  for (size_t i = 0; i < kCount; i++) {
-    in[(i * kCount) + i] = 1;
+  for (size_t i = 0; i < count; i++) {
+    in[(i * count) + i] = 1;
   }
 
   // Create task_data
@@ -75,12 +73,7 @@ TEST(nesterov_a_test_task_stl, test_task_run) {
   // Create Perf attributes
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
-  const auto t0 = std::chrono::high_resolution_clock::now();
-  perf_attr->current_timer = [&] {
-    auto current_time_point = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
-    return static_cast<double>(duration) * 1e-9;
-  };
+  perf_attr->timer = ppc::core::TimerKind::kSteady;
 
   // Create and init perf results
   auto perf_results = std::make_shared<ppc::core::PerfResults>();
@@ -2,14 +2,13 @@
 
 #include <cmath>
 #include <cstddef>
-#include <thread>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/pool/include/thread_pool.hpp"
 
 namespace {
-void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_vec) {
-  for (int i = 0; i < rc_size; ++i) {
+void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_vec, int row_begin, int row_end) {
+  for (int i = row_begin; i < row_end; ++i) {
     for (int j = 0; j < rc_size; ++j) {
       out_vec[(i * rc_size) + j] = 0;
       for (int k = 0; k < rc_size; ++k) {
@@ -39,12 +38,10 @@ bool nesterov_a_test_task_stl::TestTaskSTL::ValidationImpl() {
 }
 
 bool nesterov_a_test_task_stl::TestTaskSTL::RunImpl() {
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads(num_threads);
-  for (int i = 0; i < num_threads; i++) {
-    threads[i] = std::thread(MatMul, std::cref(input_), rc_size_, std::ref(output_));
-    threads[i].join();
-  }
+  // rows are split between the workers of the shared pool
+  ppc::core::ThreadPool::Shared().ParallelFor(0, rc_size_, [this](size_t row_begin, size_t row_end) {
+    MatMul(input_, rc_size_, output_, static_cast<int>(row_begin), static_cast<int>(row_end));
+  });
   return true;
 }
 
@@ -0,0 +1,9 @@
+#include "core/perf/include/example_benchmark.hpp"
+#include "core/registry/include/registry.hpp"
+#include "tbb/example/include/ops_tbb.hpp"
+
+namespace {
+
+const ppc::core::TaskRegistrar kRegistrar(ppc::core::ExampleBenchmark<nesterov_a_test_task_tbb::TestTaskTBB>("tbb"));
+
+}  // namespace
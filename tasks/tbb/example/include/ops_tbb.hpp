@@ -18,6 +18,8 @@ class TestTaskTBB : public ppc::core::Task {
  private:
   std::vector<int> input_, output_;
   int rc_size_{};
+  // cpu of every thread of the arena under PPC_AFFINITY, empty if threads are not pinned
+  std::vector<int> affinity_plan_;
 };
 
 }  // namespace nesterov_a_test_task_tbb
@@ -9,8 +9,30 @@
 
 #include "oneapi/tbb/task_arena.h"
 #include "oneapi/tbb/task_group.h"
+#include "oneapi/tbb/task_scheduler_observer.h"
 
 namespace {
+constexpr int kArenaThreads = 1;
+
+// pins every thread that joins the arena according to the plan
+class PinningObserver : public oneapi::tbb::task_scheduler_observer {
+ public:
+  PinningObserver(oneapi::tbb::task_arena &arena, const std::vector<int> &plan)
+      : oneapi::tbb::task_scheduler_observer(arena), plan_(plan) {
+    observe(true);
+  }
+  PinningObserver(const PinningObserver &) = delete;
+  PinningObserver &operator=(const PinningObserver &) = delete;
+  ~PinningObserver() override { observe(false); }
+
+  void on_scheduler_entry(bool /*is_worker*/) override {
+    ppc::util::PinCurrentThread(plan_, oneapi::tbb::this_task_arena::current_thread_index());
+  }
+
+ private:
+  const std::vector<int> &plan_;
+};
+
 void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_vec) {
   for (int i = 0; i < rc_size; ++i) {
     for (int j = 0; j < rc_size; ++j) {
@@ -33,6 +55,8 @@ bool nesterov_a_test_task_tbb::TestTaskTBB::PreProcessingImpl() {
   output_ = std::vector<int>(output_size, 0);
 
   rc_size_ = static_cast<int>(std::sqrt(input_size));
+  affinity_plan_ =
+      ppc::util::PlanAffinity(ppc::util::GetCpuTopology(), kArenaThreads, ppc::util::GetPPCAffinity());
   return true;
 }
 
@@ -42,7 +66,10 @@ bool nesterov_a_test_task_tbb::TestTaskTBB::ValidationImpl() {
 }
 
 bool nesterov_a_test_task_tbb::TestTaskTBB::RunImpl() {
-  oneapi::tbb::task_arena arena(1);
+  // the calling thread works in the arena too, it gets its mask back afterwards
+  const ppc::util::ScopedAffinity caller_affinity;
+  oneapi::tbb::task_arena arena(kArenaThreads);
+  PinningObserver observer(arena, affinity_plan_);
   arena.execute([&] {
     tbb::task_group tg;
     for (int thr = 0; thr < ppc::util::GetPPCNumThreads(); ++thr) {